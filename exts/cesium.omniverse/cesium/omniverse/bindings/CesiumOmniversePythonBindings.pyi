@@ -120,8 +120,36 @@ class RenderStatistics:
     @property
     def materials_loaded(self) -> int: ...
     @property
+    def http2_connections_opened(self) -> int: ...
+    @property
+    def http2_requests_completed(self) -> int: ...
+    @property
+    def http_connections_opened(self) -> int: ...
+    @property
+    def http_requests_coalesced(self) -> int: ...
+    @property
+    def http_requests_completed(self) -> int: ...
+    @property
     def max_depth_visited(self) -> int: ...
     @property
+    def task_run_time_histogram(self) -> List[int]: ...
+    @property
+    def task_run_time_p50_microseconds(self) -> int: ...
+    @property
+    def task_run_time_p99_microseconds(self) -> int: ...
+    @property
+    def task_wait_time_histogram(self) -> List[int]: ...
+    @property
+    def task_wait_time_p50_microseconds(self) -> int: ...
+    @property
+    def task_wait_time_p99_microseconds(self) -> int: ...
+    @property
+    def tasks_completed(self) -> int: ...
+    @property
+    def tasks_queued(self) -> int: ...
+    @property
+    def tasks_running(self) -> int: ...
+    @property
     def tiles_culled(self) -> int: ...
     @property
     def tiles_loaded(self) -> int: ...
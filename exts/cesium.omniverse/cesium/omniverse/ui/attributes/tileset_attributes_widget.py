@@ -52,6 +52,9 @@ class CesiumTilesetAttributesWidget(SchemaPropertiesWidget):
             with CustomLayoutGroup("Rendering"):
                 CustomLayoutProperty("cesium:suspendUpdate")
                 CustomLayoutProperty("cesium:smoothNormals")
+                CustomLayoutProperty("cesium:weldNormals")
+                CustomLayoutProperty("cesium:renderPointsAsCubes")
+                CustomLayoutProperty("cesium:optimizeMeshes")
 
         return frame.apply(props)
 
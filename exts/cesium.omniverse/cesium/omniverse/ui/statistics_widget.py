@@ -24,6 +24,18 @@ MAX_DEPTH_VISITED_TEXT = "Max depth visited"
 TILES_LOADING_WORKER_TEXT = "Tiles loading (worker)"
 TILES_LOADING_MAIN_TEXT = "Tiles loading (main)"
 TILES_LOADED_TEXT = "Tiles loaded"
+HTTP_REQUESTS_COMPLETED_TEXT = "HTTP requests completed"
+HTTP_CONNECTIONS_OPENED_TEXT = "HTTP connections opened"
+HTTP2_REQUESTS_COMPLETED_TEXT = "HTTP/2 requests completed"
+HTTP2_CONNECTIONS_OPENED_TEXT = "HTTP/2 connections opened"
+HTTP_REQUESTS_COALESCED_TEXT = "HTTP requests coalesced"
+TASKS_QUEUED_TEXT = "Tasks queued"
+TASKS_RUNNING_TEXT = "Tasks running"
+TASKS_COMPLETED_TEXT = "Tasks completed"
+TASK_WAIT_TIME_P50_TEXT = "Task wait time p50 (µs)"
+TASK_WAIT_TIME_P99_TEXT = "Task wait time p99 (µs)"
+TASK_RUN_TIME_P50_TEXT = "Task run time p50 (µs)"
+TASK_RUN_TIME_P99_TEXT = "Task run time p99 (µs)"
 
 
 class CesiumOmniverseStatisticsWidget(ui.Frame):
@@ -55,6 +67,18 @@ class CesiumOmniverseStatisticsWidget(ui.Frame):
         self._tiles_loading_worker_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
         self._tiles_loading_main_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
         self._tiles_loaded_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._http_requests_completed_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._http_connections_opened_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._http2_requests_completed_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._http2_connections_opened_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._http_requests_coalesced_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._tasks_queued_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._tasks_running_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._tasks_completed_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._task_wait_time_p50_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._task_wait_time_p99_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._task_run_time_p50_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
+        self._task_run_time_p99_model: SpaceDelimitedNumberModel = SpaceDelimitedNumberModel(0)
 
         self._subscriptions: List[carb.events.ISubscription] = []
         self._setup_subscriptions()
@@ -97,6 +121,18 @@ class CesiumOmniverseStatisticsWidget(ui.Frame):
         self._tiles_loading_worker_model.set_value(render_statistics.tiles_loading_worker)
         self._tiles_loading_main_model.set_value(render_statistics.tiles_loading_main)
         self._tiles_loaded_model.set_value(render_statistics.tiles_loaded)
+        self._http_requests_completed_model.set_value(render_statistics.http_requests_completed)
+        self._http_connections_opened_model.set_value(render_statistics.http_connections_opened)
+        self._http2_requests_completed_model.set_value(render_statistics.http2_requests_completed)
+        self._http2_connections_opened_model.set_value(render_statistics.http2_connections_opened)
+        self._http_requests_coalesced_model.set_value(render_statistics.http_requests_coalesced)
+        self._tasks_queued_model.set_value(render_statistics.tasks_queued)
+        self._tasks_running_model.set_value(render_statistics.tasks_running)
+        self._tasks_completed_model.set_value(render_statistics.tasks_completed)
+        self._task_wait_time_p50_model.set_value(render_statistics.task_wait_time_p50_microseconds)
+        self._task_wait_time_p99_model.set_value(render_statistics.task_wait_time_p99_microseconds)
+        self._task_run_time_p50_model.set_value(render_statistics.task_run_time_p50_microseconds)
+        self._task_run_time_p99_model.set_value(render_statistics.task_run_time_p99_microseconds)
 
     def _build_fn(self):
         """Builds all UI components."""
@@ -124,6 +160,18 @@ class CesiumOmniverseStatisticsWidget(ui.Frame):
                 (TILES_LOADING_WORKER_TEXT, self._tiles_loading_worker_model),
                 (TILES_LOADING_MAIN_TEXT, self._tiles_loading_main_model),
                 (TILES_LOADED_TEXT, self._tiles_loaded_model),
+                (HTTP_REQUESTS_COMPLETED_TEXT, self._http_requests_completed_model),
+                (HTTP_CONNECTIONS_OPENED_TEXT, self._http_connections_opened_model),
+                (HTTP2_REQUESTS_COMPLETED_TEXT, self._http2_requests_completed_model),
+                (HTTP2_CONNECTIONS_OPENED_TEXT, self._http2_connections_opened_model),
+                (HTTP_REQUESTS_COALESCED_TEXT, self._http_requests_coalesced_model),
+                (TASKS_QUEUED_TEXT, self._tasks_queued_model),
+                (TASKS_RUNNING_TEXT, self._tasks_running_model),
+                (TASKS_COMPLETED_TEXT, self._tasks_completed_model),
+                (TASK_WAIT_TIME_P50_TEXT, self._task_wait_time_p50_model),
+                (TASK_WAIT_TIME_P99_TEXT, self._task_wait_time_p99_model),
+                (TASK_RUN_TIME_P50_TEXT, self._task_run_time_p50_model),
+                (TASK_RUN_TIME_P99_TEXT, self._task_run_time_p99_model),
             ]:
                 with ui.HStack(height=0):
                     ui.Label(label, height=0)
@@ -279,10 +279,14 @@ class Tileset(pxr.UsdGeom.Gprim):
     @classmethod
     def CreateMaximumSimultaneousTileLoadsAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def CreateOptimizeMeshesAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def CreatePreloadAncestorsAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def CreatePreloadSiblingsAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def CreateRenderPointsAsCubesAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def CreateShowCreditsOnScreenAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def CreateSmoothNormalsAttr(cls, *args, **kwargs) -> Any: ...
@@ -293,6 +297,8 @@ class Tileset(pxr.UsdGeom.Gprim):
     @classmethod
     def CreateUrlAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def CreateWeldNormalsAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def Define(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def Get(cls, *args, **kwargs) -> Any: ...
@@ -325,10 +331,14 @@ class Tileset(pxr.UsdGeom.Gprim):
     @classmethod
     def GetMaximumSimultaneousTileLoadsAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def GetOptimizeMeshesAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def GetPreloadAncestorsAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def GetPreloadSiblingsAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def GetRenderPointsAsCubesAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def GetSchemaAttributeNames(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def GetShowCreditsOnScreenAttr(cls, *args, **kwargs) -> Any: ...
@@ -341,6 +351,8 @@ class Tileset(pxr.UsdGeom.Gprim):
     @classmethod
     def GetUrlAttr(cls, *args, **kwargs) -> Any: ...
     @classmethod
+    def GetWeldNormalsAttr(cls, *args, **kwargs) -> Any: ...
+    @classmethod
     def _GetStaticTfType(cls, *args, **kwargs) -> Any: ...
     @classmethod
     def __bool__(cls) -> bool: ...
@@ -431,6 +443,8 @@ class Tokens(Boost.Python.instance):
     @property
     def cesiumMaximumSimultaneousTileLoads(self) -> Any: ...
     @property
+    def cesiumOptimizeMeshes(self) -> Any: ...
+    @property
     def cesiumPreloadAncestors(self) -> Any: ...
     @property
     def cesiumPreloadSiblings(self) -> Any: ...
@@ -439,6 +453,8 @@ class Tokens(Boost.Python.instance):
     @property
     def cesiumProjectDefaultIonAccessTokenId(self) -> Any: ...
     @property
+    def cesiumRenderPointsAsCubes(self) -> Any: ...
+    @property
     def cesiumSelectedIonServer(self) -> Any: ...
     @property
     def cesiumShowCreditsOnScreen(self) -> Any: ...
@@ -451,6 +467,8 @@ class Tokens(Boost.Python.instance):
     @property
     def cesiumUrl(self) -> Any: ...
     @property
+    def cesiumWeldNormals(self) -> Any: ...
+    @property
     def ion(self) -> Any: ...
     @property
     def url(self) -> Any: ...
@@ -13,6 +13,8 @@
 // Needs to go after carb
 #include "pyboost11.h"
 
+#include <pybind11/stl.h>
+
 namespace pybind11::detail {
 
 PYBOOST11_TYPE_CASTER(pxr::GfMatrix4d, _("Matrix4d"));
@@ -143,7 +145,21 @@ PYBIND11_MODULE(CesiumOmniversePythonBindings, m) {
         .def_readonly("max_depth_visited", &RenderStatistics::maxDepthVisited)
         .def_readonly("tiles_loading_worker", &RenderStatistics::tilesLoadingWorker)
         .def_readonly("tiles_loading_main", &RenderStatistics::tilesLoadingMain)
-        .def_readonly("tiles_loaded", &RenderStatistics::tilesLoaded);
+        .def_readonly("tiles_loaded", &RenderStatistics::tilesLoaded)
+        .def_readonly("http_requests_completed", &RenderStatistics::httpRequestsCompleted)
+        .def_readonly("http_connections_opened", &RenderStatistics::httpConnectionsOpened)
+        .def_readonly("http2_requests_completed", &RenderStatistics::http2RequestsCompleted)
+        .def_readonly("http2_connections_opened", &RenderStatistics::http2ConnectionsOpened)
+        .def_readonly("http_requests_coalesced", &RenderStatistics::httpRequestsCoalesced)
+        .def_readonly("tasks_queued", &RenderStatistics::tasksQueued)
+        .def_readonly("tasks_running", &RenderStatistics::tasksRunning)
+        .def_readonly("tasks_completed", &RenderStatistics::tasksCompleted)
+        .def_readonly("task_wait_time_p50_microseconds", &RenderStatistics::taskWaitTimeP50Microseconds)
+        .def_readonly("task_wait_time_p99_microseconds", &RenderStatistics::taskWaitTimeP99Microseconds)
+        .def_readonly("task_run_time_p50_microseconds", &RenderStatistics::taskRunTimeP50Microseconds)
+        .def_readonly("task_run_time_p99_microseconds", &RenderStatistics::taskRunTimeP99Microseconds)
+        .def_readonly("task_wait_time_histogram", &RenderStatistics::taskWaitTimeHistogram)
+        .def_readonly("task_run_time_histogram", &RenderStatistics::taskRunTimeHistogram);
 
     py::class_<Viewport>(m, "Viewport")
         .def(py::init())
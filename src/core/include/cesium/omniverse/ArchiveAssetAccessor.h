@@ -0,0 +1,58 @@
+#pragma once
+
+#include <CesiumAsync/IAssetAccessor.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace cesium::omniverse {
+
+class ZipArchive;
+
+/**
+ * @brief Serves GET requests for file:// URLs that point into 3D Tiles archives and forwards everything else to
+ * another asset accessor.
+ *
+ * URLs take the form file:///path/to/archive.3tz/path/in/archive, e.g. file:///data/city.3tz/tileset.json, so that
+ * relative tile URLs resolve to other entries in the same archive. A bare file:///data/city.3tz serves the root
+ * tileset and is reported as file:///data/city.3tz/tileset.json for the same reason. Each archive is opened and
+ * indexed once and then kept open for the lifetime of the accessor. The accessor must be owned by a std::shared_ptr.
+ */
+class ArchiveAssetAccessor final : public CesiumAsync::IAssetAccessor,
+                                   public std::enable_shared_from_this<ArchiveAssetAccessor> {
+  public:
+    ArchiveAssetAccessor(const std::shared_ptr<CesiumAsync::IAssetAccessor>& assetAccessor);
+
+    CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+    get(const CesiumAsync::AsyncSystem& asyncSystem,
+        const std::string& url,
+        const std::vector<THeader>& headers = {}) override;
+
+    CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> request(
+        const CesiumAsync::AsyncSystem& asyncSystem,
+        const std::string& verb,
+        const std::string& url,
+        const std::vector<THeader>& headers = std::vector<THeader>(),
+        const gsl::span<const std::byte>& contentPayload = {}) override;
+
+    void tick() noexcept override;
+
+  private:
+    struct ArchiveSlot {
+        std::mutex mutex;
+        std::shared_ptr<ZipArchive> pArchive;
+    };
+
+    [[nodiscard]] std::shared_ptr<ZipArchive> getArchive(const std::string& archivePath);
+
+    std::shared_ptr<CesiumAsync::IAssetAccessor> _assetAccessor;
+
+    // Only guards the map. Each archive is opened under its own slot's mutex so that indexing one archive doesn't
+    // block requests for others.
+    std::mutex _archivesMutex;
+    std::unordered_map<std::string, std::shared_ptr<ArchiveSlot>> _archives;
+};
+
+} // namespace cesium::omniverse
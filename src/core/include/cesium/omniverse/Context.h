@@ -20,6 +20,10 @@
 #include <memory>
 #include <vector>
 
+namespace CesiumAsync {
+class IAssetAccessor;
+} // namespace CesiumAsync
+
 namespace CesiumUtility {
 class CreditSystem;
 } // namespace CesiumUtility
@@ -60,6 +64,7 @@ class Context {
 
     std::shared_ptr<TaskProcessor> getTaskProcessor();
     std::shared_ptr<HttpAssetAccessor> getHttpAssetAccessor();
+    std::shared_ptr<CesiumAsync::IAssetAccessor> getAssetAccessor();
     std::shared_ptr<CesiumUtility::CreditSystem> getCreditSystem();
     std::shared_ptr<spdlog::logger> getLogger();
 
@@ -133,6 +138,7 @@ class Context {
     void processPrimRemoved(const ChangedPrim& changedPrim);
     void processPrimAdded(const ChangedPrim& changedPrim);
     void processUsdNotifications();
+    void updateTilesets(const std::vector<Viewport>& viewports);
 
     bool getDebugDisableMaterials() const;
     bool getDebugDisableTextures() const;
@@ -147,6 +153,7 @@ class Context {
     std::shared_ptr<TaskProcessor> _taskProcessor;
     std::shared_ptr<CesiumAsync::AsyncSystem> _asyncSystem;
     std::shared_ptr<HttpAssetAccessor> _httpAssetAccessor;
+    std::shared_ptr<CesiumAsync::IAssetAccessor> _assetAccessor;
     std::shared_ptr<CesiumUtility::CreditSystem> _creditSystem;
     std::shared_ptr<spdlog::logger> _logger;
 
@@ -170,6 +177,7 @@ class Context {
     pxr::TfToken _cesiumMdlPathToken;
 
     glm::dmat4 _ecefToUsdTransform;
+    double _mainThreadLoadingDebt{0.0};
 };
 
 } // namespace cesium::omniverse
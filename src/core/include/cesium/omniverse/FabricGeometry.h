@@ -1,11 +1,22 @@
 #pragma once
 
 #include "cesium/omniverse/FabricGeometryDefinition.h"
+#include "cesium/omniverse/SmallMap.h"
 
 #include <glm/glm.hpp>
 #include <omni/fabric/IPath.h>
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/quatf.h>
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
 #include <pxr/usd/sdf/path.h>
 
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
 namespace CesiumGltf {
 struct MeshPrimitive;
 struct Model;
@@ -15,12 +26,49 @@ namespace cesium::omniverse {
 
 struct MaterialInfo;
 
+/**
+ * @brief Geometry that has been converted from glTF and is ready to be copied into Fabric as is.
+ */
+struct FabricGeometryStaging {
+    std::vector<int> faceVertexCounts;
+    std::vector<int> faceVertexIndices;
+    std::vector<glm::fvec3> points;
+
+    // Only used by Points prims
+    std::vector<float> widths;
+
+    // Indexed by primvar st index
+    std::vector<std::vector<glm::fvec2>> texcoords;
+    std::vector<glm::fvec3> normals;
+    std::vector<glm::fvec4> vertexColors;
+    std::vector<float> vertexIds;
+
+    // Raw values in the order of the geometry definition's custom vertex attributes
+    std::vector<std::vector<std::byte>> customVertexAttributes;
+
+    bool doubleSided{false};
+    pxr::GfRange3d extent;
+    pxr::GfRange3d worldExtent;
+    pxr::GfMatrix4d localToEcefTransform;
+    pxr::GfVec3d worldPosition;
+    pxr::GfQuatf worldOrientation;
+    pxr::GfVec3f worldScale;
+    int64_t tilesetId{0};
+};
+
 class FabricGeometry {
   public:
     FabricGeometry(const omni::fabric::Path& path, const FabricGeometryDefinition& geometryDefinition, long stageId);
     ~FabricGeometry();
 
-    void setGeometry(
+    /**
+     * @brief Converts glTF geometry into the arrays that will be written to this prim.
+     *
+     * Doesn't touch Fabric, so it's safe to call from a worker thread.
+     *
+     * @returns The staged geometry, or std::nullopt if the primitive has nothing to render.
+     */
+    [[nodiscard]] std::optional<FabricGeometryStaging> stageGeometry(
         int64_t tilesetId,
         const glm::dmat4& ecefToUsdTransform,
         const glm::dmat4& gltfToEcefTransform,
@@ -29,8 +77,40 @@ class FabricGeometry {
         const CesiumGltf::MeshPrimitive& primitive,
         const MaterialInfo& materialInfo,
         bool smoothNormals,
-        const std::unordered_map<uint64_t, uint64_t>& texcoordIndexMapping,
-        const std::unordered_map<uint64_t, uint64_t>& imageryTexcoordIndexMapping);
+        bool weldNormals,
+        bool optimizeMeshes,
+        const SmallMap<uint64_t, uint64_t>& texcoordIndexMapping,
+        const SmallMap<uint64_t, uint64_t>& imageryTexcoordIndexMapping) const;
+
+    /**
+     * @brief Holds staged geometry until the next call to writeGeometries.
+     *
+     * Staged geometry is dropped if the prim is released back to its pool before then.
+     */
+    void setGeometry(FabricGeometryStaging&& staging);
+
+    /**
+     * @brief Keeps every retainedStride-th point of a Points prim on the CPU so that setPointStride can write
+     * different subsets of them over time.
+     *
+     * Nothing is staged until setPointStride is called. The points are dropped when the prim is released back to its
+     * pool.
+     */
+    void setPoints(FabricGeometryStaging&& staging, uint64_t retainedStride);
+
+    /**
+     * @brief Stages every stride-th point kept by setPoints for the next call to writeGeometries.
+     *
+     * At a stride of one the kept points are written as they are instead of being copied.
+     */
+    void setPointStride(uint64_t stride);
+
+    /**
+     * @brief Writes the staged geometry of many prims to Fabric in one pass.
+     *
+     * Arrays are resized up front and attribute pointers are fetched once per bucket instead of once per prim.
+     */
+    static void writeGeometries(const std::vector<std::shared_ptr<FabricGeometry>>& geometries);
 
     void setActive(bool active);
     void setVisibility(bool visible);
@@ -44,10 +124,15 @@ class FabricGeometry {
     void initialize();
     void reset();
     bool stageDestroyed();
+    [[nodiscard]] const FabricGeometryStaging* getStaging() const;
+    void clearStaging();
 
     const omni::fabric::Path _path;
     const FabricGeometryDefinition _geometryDefinition;
     const long _stageId;
+    std::optional<FabricGeometryStaging> _staging;
+    std::optional<FabricGeometryStaging> _points;
+    bool _stagePoints{false};
 };
 
 } // namespace cesium::omniverse
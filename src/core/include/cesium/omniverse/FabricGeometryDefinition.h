@@ -5,21 +5,15 @@
 #include <cstdint>
 #include <set>
 
-namespace CesiumGltf {
-struct MeshPrimitive;
-struct Model;
-} // namespace CesiumGltf
-
 namespace cesium::omniverse {
 
+struct PrimitiveDescriptor;
+
 class FabricGeometryDefinition {
   public:
-    FabricGeometryDefinition(
-        const CesiumGltf::Model& model,
-        const CesiumGltf::MeshPrimitive& primitive,
-        const FeaturesInfo& featuresInfo,
-        bool smoothNormals);
+    FabricGeometryDefinition(const PrimitiveDescriptor& primitiveDescriptor);
 
+    [[nodiscard]] bool isPoints() const;
     [[nodiscard]] bool hasNormals() const;
     [[nodiscard]] bool hasVertexColors() const;
     [[nodiscard]] bool hasVertexIds() const;
@@ -29,6 +23,7 @@ class FabricGeometryDefinition {
     bool operator==(const FabricGeometryDefinition& other) const;
 
   private:
+    bool _isPoints{false};
     bool _hasNormals{false};
     bool _hasVertexColors{false};
     bool _hasVertexIds{false};
@@ -4,6 +4,7 @@
 #include "cesium/omniverse/FabricMaterialDefinition.h"
 #include "cesium/omniverse/GltfUtil.h"
 #include "cesium/omniverse/MetadataUtil.h"
+#include "cesium/omniverse/SmallMap.h"
 
 #ifdef CESIUM_OMNI_MSVC
 #pragma push_macro("OPAQUE")
@@ -46,18 +47,18 @@ class FabricMaterial {
         const std::vector<std::shared_ptr<FabricTexture>>& propertyTableTextures,
         const glm::dvec3& displayColor,
         double displayOpacity,
-        const std::unordered_map<uint64_t, uint64_t>& texcoordIndexMapping,
+        const SmallMap<uint64_t, uint64_t>& texcoordIndexMapping,
         const std::vector<uint64_t>& featureIdIndexSetIndexMapping,
         const std::vector<uint64_t>& featureIdAttributeSetIndexMapping,
         const std::vector<uint64_t>& featureIdTextureSetIndexMapping,
-        const std::unordered_map<uint64_t, uint64_t>& propertyTextureIndexMapping);
+        const SmallMap<uint64_t, uint64_t>& propertyTextureIndexMapping);
 
     void setImageryLayer(
         const std::shared_ptr<FabricTexture>& texture,
         const TextureInfo& textureInfo,
         uint64_t imageryLayerIndex,
         double alpha,
-        const std::unordered_map<uint64_t, uint64_t>& imageryTexcoordIndexMapping);
+        const SmallMap<uint64_t, uint64_t>& imageryTexcoordIndexMapping);
 
     void setImageryLayerAlpha(uint64_t imageryLayerIndex, double alpha);
     void setDisplayColorAndOpacity(const glm::dvec3& displayColor, double displayOpacity);
@@ -10,13 +10,12 @@
 
 namespace cesium::omniverse {
 
+struct PrimitiveDescriptor;
+
 class FabricMaterialDefinition {
   public:
     FabricMaterialDefinition(
-        const CesiumGltf::Model& model,
-        const CesiumGltf::MeshPrimitive& primitive,
-        const MaterialInfo& materialInfo,
-        const FeaturesInfo& featuresInfo,
+        const PrimitiveDescriptor& primitiveDescriptor,
         uint64_t imageryLayerCount,
         bool disableTextures,
         const pxr::SdfPath& tilesetMaterialPath);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "cesium/omniverse/GltfUtil.h"
+#include "cesium/omniverse/SmallMap.h"
 
 #ifdef CESIUM_OMNI_MSVC
 #pragma push_macro("OPAQUE")
@@ -10,6 +11,11 @@
 #include <Cesium3DTilesSelection/IPrepareRendererResources.h>
 #include <pxr/usd/sdf/path.h>
 
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string_view>
+
 namespace cesium::omniverse {
 
 class FabricGeometry;
@@ -26,12 +32,38 @@ struct FabricMesh {
     std::vector<std::shared_ptr<FabricTexture>> propertyTableTextures;
     MaterialInfo materialInfo;
     FeaturesInfo featuresInfo;
-    std::unordered_map<uint64_t, uint64_t> texcoordIndexMapping;
-    std::unordered_map<uint64_t, uint64_t> imageryTexcoordIndexMapping;
+    SmallMap<uint64_t, uint64_t> texcoordIndexMapping;
+    SmallMap<uint64_t, uint64_t> imageryTexcoordIndexMapping;
     std::vector<uint64_t> featureIdIndexSetIndexMapping;
     std::vector<uint64_t> featureIdAttributeSetIndexMapping;
     std::vector<uint64_t> featureIdTextureSetIndexMapping;
-    std::unordered_map<uint64_t, uint64_t> propertyTextureIndexMapping;
+    SmallMap<uint64_t, uint64_t> propertyTextureIndexMapping;
+};
+
+/**
+ * @brief The tileset state that worker threads need to prepare tiles.
+ *
+ * Read from USD and cesium-native on the main thread and never modified afterwards, so that worker threads don't
+ * touch the stage or the tileset. A new snapshot replaces the old one whenever any of these change.
+ */
+struct TilesetSnapshot {
+    int64_t tilesetId;
+    glm::dmat4 ecefToUsdTransform;
+    pxr::SdfPath materialPath;
+    uint64_t imageryLayerCount;
+    bool smoothNormals;
+    bool weldNormals;
+    bool renderPointsAsCubes;
+    bool optimizeMeshes;
+};
+
+/**
+ * @brief A tile that was still loading content after the last update.
+ */
+struct LoadingTile {
+    const Cesium3DTilesSelection::Tile* pTile;
+    std::string_view contentUri;
+    bool cancel;
 };
 
 struct TileRenderResources {
@@ -42,7 +74,7 @@ struct TileRenderResources {
 class FabricPrepareRenderResources final : public Cesium3DTilesSelection::IPrepareRendererResources {
   public:
     FabricPrepareRenderResources(const OmniTileset& tileset);
-    ~FabricPrepareRenderResources() override = default;
+    ~FabricPrepareRenderResources() override;
 
     CesiumAsync::Future<Cesium3DTilesSelection::TileLoadResultAndRenderResources> prepareInLoadThread(
         const CesiumAsync::AsyncSystem& asyncSystem,
@@ -78,10 +110,69 @@ class FabricPrepareRenderResources final : public Cesium3DTilesSelection::IPrepa
         const CesiumRasterOverlays::RasterOverlayTile& rasterTile,
         void* pMainThreadRendererResources) noexcept override;
 
+    /**
+     * @brief Checks whether the tileset is still attached and its prim hasn't been removed. Safe to call from worker
+     * threads.
+     */
     [[nodiscard]] bool tilesetExists() const;
     void detachTileset();
 
+    /**
+     * @brief Replaces the snapshot that tiles loaded from now on are prepared with. Must be called from the main
+     * thread.
+     */
+    void setTilesetSnapshot(std::shared_ptr<const TilesetSnapshot> pTilesetSnapshot);
+
+    /**
+     * @brief Gets the time spent in prepareInMainThread since the last call and resets it to zero.
+     */
+    [[nodiscard]] std::chrono::steady_clock::duration takeMainThreadLoadingTime();
+
+    /**
+     * @brief Cancels the preparation of tiles that are no longer wanted.
+     *
+     * A cancelled tile stops at the next stage of preparation, releases its Fabric resources and is handed back to
+     * the tileset to be loaded again later.
+     *
+     * The load result doesn't say which tile it belongs to, so each load is bound to a tile the first time its
+     * request URL ends with the content URI of exactly one loading tile. From then on it's tracked by that tile, and
+     * is cancelled once the tile is marked for cancellation or stops loading. Loads that can't be bound are never
+     * cancelled.
+     *
+     * @param loadingTiles Every tile of the tileset that is still loading content.
+     */
+    void cancelUnwantedTileLoads(const std::vector<LoadingTile>& loadingTiles);
+
+    /**
+     * @brief Updates the share of the point budget that the point clouds of a loaded tile get.
+     */
+    void setTileScreenSpaceError(const Cesium3DTilesSelection::Tile& tile, double screenSpaceError);
+
   private:
+    struct Allocators;
+
+    struct TileLoad {
+        std::string urlPath;
+        const Cesium3DTilesSelection::Tile* pTile;
+        std::weak_ptr<std::atomic<bool>> pCancelled;
+    };
+
+    [[nodiscard]] std::shared_ptr<std::atomic<bool>>
+    registerTileLoad(const Cesium3DTilesSelection::TileLoadResult& tileLoadResult);
+
+    [[nodiscard]] std::shared_ptr<const TilesetSnapshot> getTilesetSnapshot() const;
+
+    // Only accessed from the main thread. Worker threads use the snapshot instead.
     const OmniTileset* _tileset;
+
+    // Accessed with std::atomic_load and std::atomic_store
+    std::shared_ptr<const TilesetSnapshot> _pTilesetSnapshot;
+
+    std::shared_ptr<const std::atomic<bool>> _pTilesetPrimAlive;
+    std::atomic<bool> _tilesetAttached{true};
+    std::chrono::steady_clock::duration _mainThreadLoadingTime{};
+    std::mutex _tileLoadsMutex;
+    std::vector<TileLoad> _tileLoads;
+    std::unique_ptr<Allocators> _pAllocators;
 };
 } // namespace cesium::omniverse
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "cesium/omniverse/GltfUtil.h"
+#include "cesium/omniverse/PointBudget.h"
 
 #include <omni/fabric/IPath.h>
 #include <pxr/usd/sdf/assetPath.h>
@@ -8,6 +9,7 @@
 
 #include <atomic>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace CesiumGltf {
@@ -30,6 +32,8 @@ class FabricGeometryDefinition;
 class FabricMaterialDefinition;
 class FabricTexture;
 class FabricTexturePool;
+struct FabricGeometryStaging;
+struct PrimitiveDescriptor;
 
 struct SharedMaterial {
     std::shared_ptr<FabricMaterial> material;
@@ -51,22 +55,14 @@ class FabricResourceManager {
     }
 
     bool shouldAcquireMaterial(
-        const CesiumGltf::MeshPrimitive& primitive,
+        const PrimitiveDescriptor& primitiveDescriptor,
         bool hasImagery,
         const pxr::SdfPath& tilesetMaterialPath) const;
 
-    std::shared_ptr<FabricGeometry> acquireGeometry(
-        const CesiumGltf::Model& model,
-        const CesiumGltf::MeshPrimitive& primitive,
-        const FeaturesInfo& featuresInfo,
-        bool smoothNormals,
-        long stageId);
+    std::shared_ptr<FabricGeometry> acquireGeometry(const PrimitiveDescriptor& primitiveDescriptor, long stageId);
 
     std::shared_ptr<FabricMaterial> acquireMaterial(
-        const CesiumGltf::Model& model,
-        const CesiumGltf::MeshPrimitive& primitive,
-        const MaterialInfo& materialInfo,
-        const FeaturesInfo& featuresInfo,
+        const PrimitiveDescriptor& primitiveDescriptor,
         uint64_t imageryLayerCount,
         long stageId,
         int64_t tilesetId,
@@ -74,6 +70,38 @@ class FabricResourceManager {
 
     std::shared_ptr<FabricTexture> acquireTexture();
 
+    // The tryAcquire functions never create Fabric prims so they are safe to call from worker threads. They return
+    // nullptr if there is no existing pool or shared material to take from, in which case the caller should fall back
+    // to the acquire functions on the main thread.
+    std::shared_ptr<FabricGeometry> tryAcquireGeometry(const PrimitiveDescriptor& primitiveDescriptor);
+
+    std::shared_ptr<FabricMaterial> tryAcquireMaterial(
+        const PrimitiveDescriptor& primitiveDescriptor,
+        uint64_t imageryLayerCount,
+        int64_t tilesetId,
+        const pxr::SdfPath& tilesetMaterialPath);
+
+    // Grows pools ahead of demand so that worker threads find free objects. Must be called from the main thread.
+    void reservePoolCapacity();
+
+    // Staged geometry is written to Fabric in batches by writePendingGeometries, which must be called from the main
+    // thread. Geometry that doesn't fit in the time limit stays queued for the next call, and a limit of zero writes
+    // everything. The screen space error of the geometry's tile decides its share of the point budget.
+    void queueGeometry(
+        const std::shared_ptr<FabricGeometry>& geometry,
+        FabricGeometryStaging&& staging,
+        double screenSpaceError);
+    void writePendingGeometries(double timeLimitMilliseconds);
+
+    // When the point budget is non-zero, point clouds loaded from then on are written with a strided subset of their
+    // points so that the points in Fabric stay under the budget. Their points are also kept on the CPU, up to four
+    // times the budget in total, so that they can be restored later. Point clouds loaded past that only keep a strided
+    // subset. Point clouds are only budgeted if they load while the budget is enabled, so tilesets with point clouds
+    // are reloaded when it is turned on or off. Must be called from the main thread.
+    void setPointBudget(uint64_t pointBudget);
+    [[nodiscard]] uint64_t getPointBudget() const;
+    void setPointScreenSpaceError(const std::shared_ptr<FabricGeometry>& geometry, double screenSpaceError);
+
     void releaseGeometry(const std::shared_ptr<FabricGeometry>& geometry);
     void releaseMaterial(const std::shared_ptr<FabricMaterial>& material);
     void releaseTexture(const std::shared_ptr<FabricTexture>& texture);
@@ -102,6 +130,11 @@ class FabricResourceManager {
     ~FabricResourceManager();
 
   private:
+    struct BudgetedGeometry {
+        std::shared_ptr<FabricGeometry> geometry;
+        uint64_t retainedPointCount;
+    };
+
     std::shared_ptr<FabricMaterial> createMaterial(const FabricMaterialDefinition& materialDefinition, long stageId);
 
     void removeSharedMaterial(const SharedMaterial& sharedMaterial);
@@ -129,6 +162,8 @@ class FabricResourceManager {
     int64_t getNextTextureId();
     int64_t getNextPoolId();
 
+    void removeBudgetedGeometry(uint64_t pathId);
+
     std::vector<std::shared_ptr<FabricGeometryPool>> _geometryPools;
     std::vector<std::shared_ptr<FabricMaterialPool>> _materialPools;
     std::vector<std::shared_ptr<FabricTexturePool>> _texturePools;
@@ -160,6 +195,12 @@ class FabricResourceManager {
     std::vector<omni::fabric::Path> _retainedPaths;
 
     std::vector<SharedMaterial> _sharedMaterials;
+
+    std::vector<std::shared_ptr<FabricGeometry>> _pendingGeometries;
+
+    PointBudget _pointBudget;
+    std::unordered_map<uint64_t, BudgetedGeometry> _budgetedGeometries;
+    uint64_t _retainedPointCount{0};
 };
 
 } // namespace cesium::omniverse
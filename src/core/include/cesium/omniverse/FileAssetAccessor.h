@@ -0,0 +1,37 @@
+#pragma once
+
+#include <CesiumAsync/IAssetAccessor.h>
+
+#include <memory>
+
+namespace cesium::omniverse {
+
+/**
+ * @brief Serves file:// GET requests from memory mapped files and forwards everything else to another asset accessor.
+ *
+ * Response data points directly into the mapping, so local tilesets are parsed without any intermediate copies.
+ * Gzipped files are the exception. They are inflated into memory owned by the response.
+ */
+class FileAssetAccessor final : public CesiumAsync::IAssetAccessor {
+  public:
+    FileAssetAccessor(const std::shared_ptr<CesiumAsync::IAssetAccessor>& assetAccessor);
+
+    CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+    get(const CesiumAsync::AsyncSystem& asyncSystem,
+        const std::string& url,
+        const std::vector<THeader>& headers = {}) override;
+
+    CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> request(
+        const CesiumAsync::AsyncSystem& asyncSystem,
+        const std::string& verb,
+        const std::string& url,
+        const std::vector<THeader>& headers = std::vector<THeader>(),
+        const gsl::span<const std::byte>& contentPayload = {}) override;
+
+    void tick() noexcept override;
+
+  private:
+    std::shared_ptr<CesiumAsync::IAssetAccessor> _assetAccessor;
+};
+
+} // namespace cesium::omniverse
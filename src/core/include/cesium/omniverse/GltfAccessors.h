@@ -12,8 +12,26 @@
 
 #include <gsl/span>
 
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
 namespace cesium::omniverse {
 
+/**
+ * @brief Gets the accessor values as a plain array if they are tightly packed.
+ *
+ * @returns A pointer to the first value, or nullptr if the view is invalid or its values are interleaved with other
+ * data.
+ */
+template <typename T> const T* getPackedValues(const CesiumGltf::AccessorView<T>& view) {
+    if (view.status() != CesiumGltf::AccessorViewStatus::Valid || view.stride() != static_cast<int64_t>(sizeof(T))) {
+        return nullptr;
+    }
+
+    return reinterpret_cast<const T*>(view.data() + view.offset());
+}
+
 class PositionsAccessor {
   public:
     PositionsAccessor();
@@ -48,6 +66,7 @@ class IndicesAccessor {
     CesiumGltf::AccessorView<uint8_t> _uint8View;
     CesiumGltf::AccessorView<uint16_t> _uint16View;
     CesiumGltf::AccessorView<uint32_t> _uint32View;
+    const void* _pPackedValues{nullptr};
     uint64_t _size;
 };
 
@@ -56,13 +75,21 @@ class NormalsAccessor {
     NormalsAccessor();
     NormalsAccessor(const CesiumGltf::AccessorView<glm::fvec3>& view);
 
-    static NormalsAccessor GenerateSmooth(const PositionsAccessor& positions, const IndicesAccessor& indices);
+    /**
+     * @brief Generates smooth normals by averaging the normals of the triangles around each vertex.
+     *
+     * Triangles are accumulated in parallel when called from a worker thread. When weldPositions is true, vertices
+     * with identical positions share one normal so that vertices split along UV seams don't shade as a hard edge.
+     */
+    static NormalsAccessor
+    GenerateSmooth(const PositionsAccessor& positions, const IndicesAccessor& indices, bool weldPositions);
 
     void fill(const gsl::span<glm::fvec3>& values) const;
     [[nodiscard]] uint64_t size() const;
 
   private:
-    std::vector<glm::fvec3> _computed;
+    // Returned to a shared pool when the last accessor referencing it is destroyed
+    std::shared_ptr<std::vector<glm::fvec3>> _pComputed;
     CesiumGltf::AccessorView<glm::fvec3> _view;
     uint64_t _size;
 };
@@ -77,6 +104,7 @@ class TexcoordsAccessor {
 
   private:
     CesiumGltf::AccessorView<glm::fvec2> _view;
+    const glm::fvec2* _pPackedValues{nullptr};
     bool _flipVertical;
     uint64_t _size;
 };
@@ -109,6 +137,9 @@ class VertexColorsAccessor {
     CesiumGltf::AccessorView<glm::fvec3> _float32Vec3View;
     CesiumGltf::AccessorView<glm::fvec4> _float32Vec4View;
 
+    // Only set for integer RGBA colors, which are converted with SIMD kernels when they are tightly packed. Integer
+    // RGB colors are never tightly packed in valid glTF since vertex attribute strides are multiples of four bytes.
+    const void* _pPackedValues{nullptr};
     uint64_t _size;
 };
 
@@ -142,14 +173,36 @@ template <DataType T> class VertexAttributeAccessor {
         : _size(0){};
     VertexAttributeAccessor(const CesiumGltf::AccessorView<GetNativeType<T>>& view)
         : _view(view)
+        , _pPackedValues(getPackedValues(view))
         , _size(static_cast<uint64_t>(view.size())) {}
 
     void fill(const gsl::span<GetNativeType<getPrimvarType<T>()>>& values, uint64_t repeat = 1) const {
+        using PrimvarType = GetNativeType<getPrimvarType<T>()>;
+
         const auto size = values.size();
         assert(size == _size * repeat);
 
-        for (uint64_t i = 0; i < size; i++) {
-            values[i] = static_cast<GetNativeType<getPrimvarType<T>()>>(_view[static_cast<int64_t>(i / repeat)]);
+        if constexpr (std::is_same_v<GetNativeType<T>, PrimvarType>) {
+            if (_pPackedValues != nullptr && repeat == 1) {
+                std::memcpy(values.data(), _pPackedValues, size * sizeof(PrimvarType));
+                return;
+            }
+        }
+
+        const auto fillFrom = [this, &values, repeat](const auto& source) {
+            for (uint64_t i = 0; i < _size; i++) {
+                const auto value = static_cast<PrimvarType>(source[static_cast<int64_t>(i)]);
+
+                for (uint64_t j = 0; j < repeat; j++) {
+                    values[i * repeat + j] = value;
+                }
+            }
+        };
+
+        if (_pPackedValues != nullptr) {
+            fillFrom(_pPackedValues);
+        } else {
+            fillFrom(_view);
         }
     }
 
@@ -159,6 +212,7 @@ template <DataType T> class VertexAttributeAccessor {
 
   private:
     CesiumGltf::AccessorView<GetNativeType<T>> _view;
+    const GetNativeType<T>* _pPackedValues{nullptr};
     uint64_t _size;
 };
 
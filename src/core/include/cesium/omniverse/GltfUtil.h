@@ -109,7 +109,8 @@ NormalsAccessor getNormals(
     const CesiumGltf::MeshPrimitive& primitive,
     const PositionsAccessor& positionsAccessor,
     const IndicesAccessor& indices,
-    bool smoothNormals);
+    bool smoothNormals,
+    bool weldNormals);
 
 TexcoordsAccessor
 getTexcoords(const CesiumGltf::Model& model, const CesiumGltf::MeshPrimitive& primitive, uint64_t setIndex);
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <gsl/span>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace cesium::omniverse::GzipUtil {
+
+/**
+ * @brief Checks for the gzip magic number.
+ */
+[[nodiscard]] bool isGzip(const gsl::span<const std::byte>& data);
+
+/**
+ * @brief Inflates a gzip stream, including streams made of several concatenated members.
+ *
+ * The size stored in the gzip trailer is untrusted, so it's only used as a bounded hint for the initial output size.
+ * The output grows as needed.
+ *
+ * @returns The inflated data, or std::nullopt if the data isn't a complete, valid gzip stream.
+ */
+[[nodiscard]] std::optional<std::vector<std::byte>> gunzip(const gsl::span<const std::byte>& data);
+
+} // namespace cesium::omniverse::GzipUtil
@@ -1,30 +1,56 @@
 #pragma once
 
+#include <CesiumAsync/Future.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumAsync/IAssetRequest.h>
 #include <CesiumAsync/IAssetResponse.h>
-#include <cpr/cpr.h>
+#include <curl/curl.h>
 
 #include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace cesium::omniverse {
+struct HttpStatistics {
+    uint64_t requestsCompleted{0};
+    uint64_t connectionsOpened{0};
+    uint64_t http2RequestsCompleted{0};
+    uint64_t http2ConnectionsOpened{0};
+    uint64_t requestsCoalesced{0};
+};
+
+/**
+ * @brief Priority hint for requests whose URL path ends with the given suffix.
+ *
+ * Higher priorities are started first. Requests that are no longer wanted are deferred behind all other work, and
+ * may be preempted if they are already in flight.
+ */
+struct RequestPriorityHint {
+    std::string urlSuffix;
+    double priority;
+    bool wanted;
+};
+
 class HttpAssetResponse final : public CesiumAsync::IAssetResponse {
   public:
-    HttpAssetResponse(cpr::Response&& response)
-        : _response{std::move(response)} {
-        for (const auto& header : _response.header) {
-            _headers.insert({header.first, header.second});
-        }
-    }
+    HttpAssetResponse(uint16_t statusCode, CesiumAsync::HttpHeaders&& headers, std::vector<std::byte>&& data)
+        : _statusCode{statusCode}
+        , _headers{std::move(headers)}
+        , _data{std::move(data)} {}
 
     [[nodiscard]] uint16_t statusCode() const override {
-        return uint16_t(_response.status_code);
+        return _statusCode;
     }
 
     [[nodiscard]] std::string contentType() const override {
-        auto it = _response.header.find("content-type");
-        if (it != _response.header.end()) {
+        auto it = _headers.find("content-type");
+        if (it != _headers.end()) {
             return it->second;
         }
 
@@ -36,12 +62,13 @@ class HttpAssetResponse final : public CesiumAsync::IAssetResponse {
     }
 
     [[nodiscard]] gsl::span<const std::byte> data() const override {
-        return {reinterpret_cast<const std::byte*>(_response.text.data()), _response.text.size()};
+        return {_data.data(), _data.size()};
     }
 
   private:
+    uint16_t _statusCode;
     CesiumAsync::HttpHeaders _headers;
-    cpr::Response _response;
+    std::vector<std::byte> _data;
 };
 
 class HttpAssetRequest final : public CesiumAsync::IAssetRequest {
@@ -50,7 +77,7 @@ class HttpAssetRequest final : public CesiumAsync::IAssetRequest {
         std::string&& method,
         std::string url,
         const std::vector<CesiumAsync::IAssetAccessor::THeader>& headers,
-        cpr::Response&& response)
+        HttpAssetResponse&& response)
         : _method{std::move(method)}
         , _url{std::move(url)}
         , _headers{headers.begin(), headers.end()}
@@ -79,9 +106,33 @@ class HttpAssetRequest final : public CesiumAsync::IAssetRequest {
     HttpAssetResponse _response;
 };
 
+/**
+ * @brief Asset accessor that performs all transfers on a single curl multi handle.
+ *
+ * Connections are kept alive and reused across requests, and DNS and TLS sessions are shared between transfers.
+ * When HTTP/2 is enabled requests to the same host are multiplexed over a single connection, falling back to
+ * HTTP/1.1 if the server doesn't negotiate HTTP/2.
+ *
+ * At most a fixed number of transfers are active at once. Queued requests are re-sorted whenever requests are added
+ * or the priority hints registered with {@link setRequestPriorityHints} change. Requests without a matching hint keep
+ * their submission order and are started before hinted requests since they are usually tileset metadata or imagery
+ * that other loads depend on.
+ *
+ * GET requests for a URL that is already in flight with the same headers attach to the existing transfer instead of
+ * starting a new one.
+ *
+ * Requests may be issued from any thread. Transfers run on a dedicated thread that sleeps in curl_multi_poll until
+ * there is socket activity or new work, so downloads don't depend on the frame rate. Only promise resolution is
+ * posted to the main thread of the request's AsyncSystem.
+ */
 class HttpAssetAccessor final : public CesiumAsync::IAssetAccessor {
   public:
     HttpAssetAccessor(const std::filesystem::path& certificatePath);
+    ~HttpAssetAccessor() override;
+    HttpAssetAccessor(const HttpAssetAccessor&) = delete;
+    HttpAssetAccessor& operator=(const HttpAssetAccessor&) = delete;
+    HttpAssetAccessor(HttpAssetAccessor&&) noexcept = delete;
+    HttpAssetAccessor& operator=(HttpAssetAccessor&&) noexcept = delete;
 
     CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
     get(const CesiumAsync::AsyncSystem& asyncSystem,
@@ -97,7 +148,57 @@ class HttpAssetAccessor final : public CesiumAsync::IAssetAccessor {
 
     void tick() noexcept override;
 
+    [[nodiscard]] HttpStatistics getStatistics();
+
+    void setRequestPriorityHints(int64_t sourceId, std::vector<RequestPriorityHint>&& hints);
+    void clearRequestPriorityHints(int64_t sourceId);
+
   private:
-    std::shared_ptr<cpr::Interceptor> _interceptor;
+    struct Transfer;
+
+    CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> enqueue(
+        const CesiumAsync::AsyncSystem& asyncSystem,
+        const std::string& verb,
+        const std::string& url,
+        const std::vector<THeader>& headers,
+        const gsl::span<const std::byte>& contentPayload,
+        std::string&& coalescingKey);
+
+    void run();
+    bool takePendingWork();
+    void updateQueuedTransfers();
+    void preemptUnwantedTransfers();
+    void startQueuedTransfers();
+    void startTransfer(std::unique_ptr<Transfer> transfer);
+    std::unique_ptr<Transfer> stopTransfer(CURL* easyHandle);
+    void completeTransfers();
+    CURL* acquireEasyHandle();
+
+    std::string _certificatePath;
+    bool _http2Enabled;
+    uint64_t _maxActiveTransfers;
+    CURLM* _multiHandle{nullptr};
+    CURLSH* _shareHandle{nullptr};
+
+    // Only accessed from the transfer thread
+    std::vector<CURL*> _idleEasyHandles;
+    std::unordered_map<CURL*, std::unique_ptr<Transfer>> _activeTransfers;
+    std::vector<std::unique_ptr<Transfer>> _queuedTransfers;
+    std::unordered_map<int64_t, std::vector<RequestPriorityHint>> _requestPriorityHints;
+
+    // Handed from other threads to the transfer thread. A hint update without a value clears the source's hints.
+    std::mutex _pendingMutex;
+    bool _stopping{false};
+    uint64_t _nextSequenceNumber{0};
+    std::vector<std::unique_ptr<Transfer>> _pendingTransfers;
+    std::unordered_map<int64_t, std::optional<std::vector<RequestPriorityHint>>> _pendingRequestPriorityHints;
+    HttpStatistics _statistics;
+
+    std::thread _transferThread;
+
+    std::mutex _inFlightRequestsMutex;
+    std::unordered_map<std::string, CesiumAsync::SharedFuture<std::shared_ptr<CesiumAsync::IAssetRequest>>>
+        _inFlightRequests;
+    uint64_t _requestsCoalesced{0};
 };
 } // namespace cesium::omniverse
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <gsl/span>
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+
+namespace cesium::omniverse {
+
+/**
+ * @brief A read-only memory mapping of an entire file. The mapping stays valid until the object is destroyed.
+ */
+class MemoryMappedFile {
+  public:
+    /**
+     * @brief Maps the file at the given path.
+     *
+     * @param path The path of the file to map.
+     * @returns The mapped file, or nullptr if the file couldn't be opened or mapped.
+     */
+    [[nodiscard]] static std::unique_ptr<MemoryMappedFile> open(const std::filesystem::path& path);
+
+    ~MemoryMappedFile();
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+    MemoryMappedFile(MemoryMappedFile&&) noexcept = delete;
+    MemoryMappedFile& operator=(MemoryMappedFile&&) noexcept = delete;
+
+    [[nodiscard]] gsl::span<const std::byte> getData() const;
+
+    /**
+     * @brief Hints to the OS that the given range will be read soon so that it can start reading it ahead of time.
+     */
+    void willNeed(size_t offset, size_t size) const;
+
+  private:
+    MemoryMappedFile(void* pMapping, size_t size);
+
+    void* _pMapping;
+    size_t _size;
+};
+
+} // namespace cesium::omniverse
@@ -4,6 +4,7 @@
 #include "cesium/omniverse/FabricTexture.h"
 #include "cesium/omniverse/GltfUtil.h"
 #include "cesium/omniverse/LoggerSink.h"
+#include "cesium/omniverse/SmallMap.h"
 
 #include <CesiumGltf/ExtensionExtMeshFeatures.h>
 #include <CesiumGltf/ExtensionMeshPrimitiveExtStructuralMetadata.h>
@@ -547,7 +548,7 @@ getStyleableProperties(const CesiumGltf::Model& model, const CesiumGltf::MeshPri
 std::vector<const CesiumGltf::ImageCesium*>
 getPropertyTextureImages(const CesiumGltf::Model& model, const CesiumGltf::MeshPrimitive& primitive);
 
-std::unordered_map<uint64_t, uint64_t>
+SmallMap<uint64_t, uint64_t>
 getPropertyTextureIndexMapping(const CesiumGltf::Model& model, const CesiumGltf::MeshPrimitive& primitive);
 
 std::vector<TextureData>
@@ -14,12 +14,18 @@ template <typename T> class ObjectPool {
     virtual ~ObjectPool() = default;
 
     std::shared_ptr<T> acquire() {
-        const auto percentActive = computePercentActive();
+        reserve();
+        return tryAcquire();
+    }
 
-        if (percentActive > _doublingThreshold) {
-            // Capacity is initially 0, so make sure the new capacity is at least 1
-            const auto newCapacity = std::max(_capacity * 2, uint64_t(1));
-            setCapacity(newCapacity);
+    /**
+     * @brief Acquires an inactive object without creating new objects.
+     *
+     * @returns The object, or nullptr if every object is in use.
+     */
+    std::shared_ptr<T> tryAcquire() {
+        if (_queue.empty()) {
+            return nullptr;
         }
 
         const auto object = _queue.front();
@@ -29,6 +35,19 @@ template <typename T> class ObjectPool {
         return object;
     }
 
+    /**
+     * @brief Doubles the capacity if more than the doubling threshold of objects are in use.
+     */
+    void reserve() {
+        const auto percentActive = computePercentActive();
+
+        if (percentActive > _doublingThreshold) {
+            // Capacity is initially 0, so make sure the new capacity is at least 1
+            const auto newCapacity = std::max(_capacity * 2, uint64_t(1));
+            setCapacity(newCapacity);
+        }
+    }
+
     void release(std::shared_ptr<T> object) {
         _queue.push_back(object);
         setActive(object, false);
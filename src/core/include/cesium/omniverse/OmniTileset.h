@@ -8,9 +8,11 @@
 #include <atomic>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace Cesium3DTilesSelection {
+class Tile;
 class Tileset;
 class ViewState;
 class ViewUpdateResult;
@@ -68,6 +70,9 @@ class OmniTileset {
     [[nodiscard]] double getCulledScreenSpaceError() const;
     [[nodiscard]] bool getSuspendUpdate() const;
     [[nodiscard]] bool getSmoothNormals() const;
+    [[nodiscard]] bool getWeldNormals() const;
+    [[nodiscard]] bool getRenderPointsAsCubes() const;
+    [[nodiscard]] bool getOptimizeMeshes() const;
     [[nodiscard]] double getMainThreadLoadingTimeLimit() const;
     [[nodiscard]] bool getShowCreditsOnScreen() const;
     [[nodiscard]] pxr::CesiumGeoreference getGeoreference() const;
@@ -78,6 +83,19 @@ class OmniTileset {
     [[nodiscard]] int64_t getTilesetId() const;
     [[nodiscard]] TilesetStatistics getStatistics() const;
 
+    /**
+     * @brief Gets a flag that stays true until the tileset prim is removed from the stage.
+     *
+     * The flag can be read from any thread without touching the stage and remains valid after the tileset is destroyed.
+     */
+    [[nodiscard]] std::shared_ptr<const std::atomic<bool>> getPrimAliveFlag() const;
+
+    /**
+     * @brief Clears the prim alive flag. Called as soon as USD reports that the prim was removed, which is before the
+     * tileset itself is removed.
+     */
+    void setPrimRemoved();
+
     void updateTilesetOptionsFromProperties();
 
     void reload();
@@ -91,13 +109,43 @@ class OmniTileset {
     void updateShaderInput(const pxr::SdfPath& shaderPath, const pxr::TfToken& attributeName);
     void updateDisplayColorAndOpacity();
 
+    /**
+     * @brief Sets the time the next update may spend finishing tile loads on the main thread.
+     *
+     * @param budgetMilliseconds The budget in milliseconds, or zero to use the tileset's own time limit.
+     */
+    void setMainThreadLoadingBudget(double budgetMilliseconds);
+
+    /**
+     * @brief Gets the time in milliseconds the last update spent writing loaded tiles to Fabric.
+     */
+    [[nodiscard]] double getMainThreadLoadingTime() const;
+
+    /**
+     * @brief Gets the largest screen space error of the selected tiles that were left waiting for the main thread
+     * after the last update, or zero if there are none.
+     */
+    [[nodiscard]] double getMainThreadLoadScreenSpaceError() const;
+
     void onUpdateFrame(const std::vector<Viewport>& viewports);
 
+    /**
+     * @brief Computes the largest screen space error of a tile across the views from the last update.
+     */
+    [[nodiscard]] double computeScreenSpaceError(const Cesium3DTilesSelection::Tile& tile) const;
+
+    /**
+     * @brief Checks whether any loaded tile has point cloud geometry.
+     */
+    [[nodiscard]] bool hasPointContent() const;
+
   private:
     void updateTransform();
     void updateView(const std::vector<Viewport>& viewports);
     bool updateExtent();
     void updateLoadStatus();
+    void updateLoadPriorities();
+    void updateTilesetSnapshot();
 
     std::unique_ptr<Cesium3DTilesSelection::Tileset> _tileset;
     std::shared_ptr<FabricPrepareRenderResources> _renderResourcesPreparer;
@@ -105,10 +153,17 @@ class OmniTileset {
 
     pxr::SdfPath _tilesetPath;
     int64_t _tilesetId;
-    glm::dmat4 _ecefToUsdTransform;
+    glm::dmat4 _ecefToUsdTransform{1.0};
     std::vector<Cesium3DTilesSelection::ViewState> _viewStates;
     bool _extentSet = false;
     bool _activeLoading{false};
+    double _mainThreadLoadingTime{0.0};
+    double _mainThreadLoadScreenSpaceError{0.0};
     std::vector<pxr::SdfPath> _imageryPaths;
+    std::unordered_map<const Cesium3DTilesSelection::Tile*, uint64_t> _unwantedFrameCounts;
+    bool _weldNormals{false};
+    bool _renderPointsAsCubes{false};
+    bool _optimizeMeshes{false};
+    std::shared_ptr<std::atomic<bool>> _pPrimAlive{std::make_shared<std::atomic<bool>>(true)};
 };
 } // namespace cesium::omniverse
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cesium::omniverse {
+
+/**
+ * @brief Splits a point budget between point clouds by giving each one a stride to sample its points with.
+ *
+ * Point clouds with a larger weight, normally the screen space error of their tile, keep a larger share of their
+ * points. Strides are powers of two so that the points kept at one stride are a subset of the points kept at any
+ * smaller stride, which keeps points from popping in and out as strides change. A budget of zero disables the budget
+ * and gives every point cloud a stride of one.
+ */
+class PointBudget {
+  public:
+    void setBudget(uint64_t budget);
+    [[nodiscard]] uint64_t getBudget() const;
+
+    /**
+     * @brief Adds a point cloud. It has no stride until the next call to update.
+     */
+    void add(uint64_t id, uint64_t pointCount, double weight);
+    void remove(uint64_t id);
+    void setWeight(uint64_t id, double weight);
+    void clear();
+
+    /**
+     * @brief Recomputes strides so that the points kept fit in the budget.
+     *
+     * @returns The ids and new strides of point clouds that were added or whose stride changed since the last update.
+     */
+    [[nodiscard]] std::vector<std::pair<uint64_t, uint64_t>> update();
+
+    [[nodiscard]] uint64_t getStride(uint64_t id) const;
+
+    /**
+     * @brief Gets the number of points kept at the strides from the last update.
+     */
+    [[nodiscard]] uint64_t getPointsKept() const;
+
+  private:
+    struct Entry {
+        uint64_t pointCount;
+        double weight;
+        uint64_t stride;
+    };
+
+    [[nodiscard]] uint64_t countPointsKept(double scale) const;
+
+    std::unordered_map<uint64_t, Entry> _entries;
+    uint64_t _budget{0};
+    bool _dirty{false};
+};
+
+} // namespace cesium::omniverse
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "cesium/omniverse/GltfUtil.h"
+#include "cesium/omniverse/MetadataUtil.h"
+#include "cesium/omniverse/SmallMap.h"
+
+#include <pxr/usd/sdf/path.h>
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+namespace CesiumGltf {
+struct ImageCesium;
+struct MeshPrimitive;
+struct Model;
+} // namespace CesiumGltf
+
+namespace cesium::omniverse {
+
+/**
+ * @brief Everything Fabric resources are chosen and filled from that can be read from a glTF primitive up front.
+ *
+ * Built once per primitive on the load thread so that acquiring geometry, materials, and textures doesn't walk the
+ * glTF again for each of them.
+ */
+struct PrimitiveDescriptor {
+    // Point clouds are drawn as a Points prim unless the tileset asks for cubes, which are drawn as a Mesh
+    bool isPoints{false};
+    bool hasNormals{false};
+    bool hasVertexColors{false};
+    bool hasMaterial{false};
+    std::vector<uint64_t> texcoordSetIndexes;
+    std::vector<uint64_t> imageryTexcoordSetIndexes;
+    std::set<VertexAttributeInfo> customVertexAttributes;
+    MaterialInfo materialInfo;
+    FeaturesInfo featuresInfo;
+
+    // Metadata is only gathered when the tileset material can style it
+    std::vector<MetadataUtil::PropertyDefinition> styleableProperties;
+    std::vector<const CesiumGltf::ImageCesium*> propertyTextureImages;
+    SmallMap<uint64_t, uint64_t> propertyTextureIndexMapping;
+    uint64_t propertyTableTextureCount{0};
+};
+
+PrimitiveDescriptor createPrimitiveDescriptor(
+    const CesiumGltf::Model& model,
+    const CesiumGltf::MeshPrimitive& primitive,
+    bool smoothNormals,
+    bool renderPointsAsCubes,
+    const pxr::SdfPath& tilesetMaterialPath);
+
+} // namespace cesium::omniverse
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <CesiumAsync/IAssetAccessor.h>
+
+#include <filesystem>
+#include <memory>
+
+namespace cesium::omniverse {
+
+class RequestArchiveWriter;
+
+/**
+ * @brief Forwards requests to another asset accessor and appends every completed request to an archive that can be
+ * played back with {@link ReplayAssetAccessor}.
+ */
+class RecordingAssetAccessor final : public CesiumAsync::IAssetAccessor {
+  public:
+    RecordingAssetAccessor(
+        const std::shared_ptr<CesiumAsync::IAssetAccessor>& assetAccessor,
+        const std::filesystem::path& archivePath);
+
+    CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+    get(const CesiumAsync::AsyncSystem& asyncSystem,
+        const std::string& url,
+        const std::vector<THeader>& headers = {}) override;
+
+    CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> request(
+        const CesiumAsync::AsyncSystem& asyncSystem,
+        const std::string& verb,
+        const std::string& url,
+        const std::vector<THeader>& headers = std::vector<THeader>(),
+        const gsl::span<const std::byte>& contentPayload = {}) override;
+
+    void tick() noexcept override;
+
+  private:
+    CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+    record(CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>&& future);
+
+    std::shared_ptr<CesiumAsync::IAssetAccessor> _assetAccessor;
+    std::shared_ptr<RequestArchiveWriter> _archiveWriter;
+};
+
+} // namespace cesium::omniverse
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 namespace cesium::omniverse {
 
@@ -21,6 +22,20 @@ struct RenderStatistics {
     uint64_t tilesLoadingWorker{0};
     uint64_t tilesLoadingMain{0};
     uint64_t tilesLoaded{0};
+    uint64_t httpRequestsCompleted{0};
+    uint64_t httpConnectionsOpened{0};
+    uint64_t http2RequestsCompleted{0};
+    uint64_t http2ConnectionsOpened{0};
+    uint64_t httpRequestsCoalesced{0};
+    uint64_t tasksQueued{0};
+    uint64_t tasksRunning{0};
+    uint64_t tasksCompleted{0};
+    uint64_t taskWaitTimeP50Microseconds{0};
+    uint64_t taskWaitTimeP99Microseconds{0};
+    uint64_t taskRunTimeP50Microseconds{0};
+    uint64_t taskRunTimeP99Microseconds{0};
+    std::vector<uint64_t> taskWaitTimeHistogram;
+    std::vector<uint64_t> taskRunTimeHistogram;
 };
 
 } // namespace cesium::omniverse
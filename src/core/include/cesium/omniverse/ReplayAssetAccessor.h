@@ -0,0 +1,60 @@
+#pragma once
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/IAssetAccessor.h>
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace cesium::omniverse {
+
+class RequestArchiveReader;
+struct ArchivedRequestEntry;
+
+/**
+ * @brief Serves requests from an archive written by {@link RecordingAssetAccessor} without touching the network.
+ *
+ * Optionally simulates a network link with a fixed latency per request and a bandwidth shared by all requests.
+ * Simulated responses are delivered in {@link tick}. Requests that aren't in the archive complete with a 404.
+ */
+class ReplayAssetAccessor final : public CesiumAsync::IAssetAccessor {
+  public:
+    ReplayAssetAccessor(
+        const std::filesystem::path& archivePath,
+        double latencySeconds,
+        double bandwidthBytesPerSecond);
+
+    CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+    get(const CesiumAsync::AsyncSystem& asyncSystem,
+        const std::string& url,
+        const std::vector<THeader>& headers = {}) override;
+
+    CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> request(
+        const CesiumAsync::AsyncSystem& asyncSystem,
+        const std::string& verb,
+        const std::string& url,
+        const std::vector<THeader>& headers = std::vector<THeader>(),
+        const gsl::span<const std::byte>& contentPayload = {}) override;
+
+    void tick() noexcept override;
+
+  private:
+    struct PendingResponse {
+        std::chrono::steady_clock::time_point readyTime;
+        CesiumAsync::Promise<void> promise;
+    };
+
+    std::shared_ptr<RequestArchiveReader> _archiveReader;
+    std::unordered_map<std::string, const ArchivedRequestEntry*> _entries;
+    std::chrono::duration<double> _latency;
+    double _bandwidthBytesPerSecond;
+
+    std::mutex _pendingResponsesMutex;
+    std::vector<PendingResponse> _pendingResponses;
+    std::chrono::steady_clock::time_point _linkAvailableTime;
+};
+
+} // namespace cesium::omniverse
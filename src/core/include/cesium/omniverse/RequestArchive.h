@@ -0,0 +1,69 @@
+#pragma once
+
+#include <CesiumAsync/HttpHeaders.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace CesiumAsync {
+class IAssetRequest;
+}
+
+namespace cesium::omniverse {
+
+/**
+ * @brief Location of a request in an archive. The response body is only read when the request is replayed.
+ */
+struct ArchivedRequestEntry {
+    std::string method;
+    std::string url;
+    CesiumAsync::HttpHeaders requestHeaders;
+    uint16_t statusCode{0};
+    CesiumAsync::HttpHeaders responseHeaders;
+    uint64_t dataOffset{0};
+    uint64_t dataSize{0};
+};
+
+/**
+ * @brief Appends completed requests to an archive file. Safe to call from any thread.
+ */
+class RequestArchiveWriter {
+  public:
+    RequestArchiveWriter(const std::filesystem::path& archivePath);
+
+    void write(const CesiumAsync::IAssetRequest& request);
+
+  private:
+    std::mutex _mutex;
+    std::ofstream _stream;
+};
+
+/**
+ * @brief Reads the index of an archive up front and the response bodies on demand. Safe to call from any thread.
+ *
+ * If any part of the index is truncated or corrupt the archive is rejected and has no entries.
+ */
+class RequestArchiveReader {
+  public:
+    RequestArchiveReader(const std::filesystem::path& archivePath);
+
+    [[nodiscard]] const std::vector<ArchivedRequestEntry>& getEntries() const;
+    /**
+     * @brief Reads the response body of an entry.
+     *
+     * @returns The response body, or std::nullopt if the archive no longer holds all of it.
+     */
+    [[nodiscard]] std::optional<std::vector<std::byte>> readData(const ArchivedRequestEntry& entry);
+
+  private:
+    std::mutex _mutex;
+    std::ifstream _stream;
+    std::vector<ArchivedRequestEntry> _entries;
+};
+
+} // namespace cesium::omniverse
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <vector>
@@ -17,5 +18,18 @@ const std::vector<UserAccessToken> getAccessTokens();
 void setAccessToken(const UserAccessToken& userAccessToken);
 void removeAccessToken(const std::string& ionApiUrl);
 void clearTokens();
+uint64_t getMaxCacheItems();
+uint64_t getRequestsPerCachePrune();
+uint64_t getMaxConnectionsPerHost();
+bool getHttp2Enabled();
+uint64_t getMaxConcurrentStreams();
+uint64_t getMaxActiveRequests();
+std::string getRequestArchiveMode();
+std::string getRequestArchivePath();
+uint64_t getReplayLatencyMilliseconds();
+double getReplayBandwidthMegabitsPerSecond();
+uint64_t getWorkerThreadCount();
+double getMainThreadLoadingBudgetMilliseconds();
+uint64_t getPointBudget();
 
 } // namespace cesium::omniverse::Settings
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+
+namespace cesium::omniverse::SimdUtil {
+
+enum class SimdLevel {
+    NONE,
+    SSE41,
+    AVX2,
+};
+
+/**
+ * @brief Gets the widest instruction set supported by the CPU that the kernels below can use. Detected once.
+ */
+[[nodiscard]] SimdLevel getSimdLevel();
+
+/**
+ * @brief Widens tightly packed unsigned 8-bit values to 32-bit signed integers.
+ */
+void convertUint8ToInt32(const uint8_t* pSource, int32_t* pTarget, uint64_t count);
+
+/**
+ * @brief Widens tightly packed unsigned 16-bit values to 32-bit signed integers.
+ */
+void convertUint16ToInt32(const uint16_t* pSource, int32_t* pTarget, uint64_t count);
+
+/**
+ * @brief Copies tightly packed texture coordinates and flips them vertically.
+ *
+ * @param pSource The source coordinates as interleaved u, v pairs.
+ * @param pTarget The target coordinates as interleaved u, v pairs.
+ * @param count The number of coordinate pairs.
+ */
+void copyFlipVertical(const float* pSource, float* pTarget, uint64_t count);
+
+/**
+ * @brief Converts tightly packed normalized unsigned 8-bit RGBA colors to floating point RGBA.
+ *
+ * @param pSource The source colors as four components each.
+ * @param pTarget The target colors as four floats each.
+ * @param count The number of colors.
+ */
+void normalizeUint8Colors(const uint8_t* pSource, float* pTarget, uint64_t count);
+
+/**
+ * @brief Converts tightly packed normalized unsigned 16-bit RGBA colors to floating point RGBA.
+ *
+ * @param pSource The source colors as four components each.
+ * @param pTarget The target colors as four floats each.
+ * @param count The number of colors.
+ */
+void normalizeUint16Colors(const uint16_t* pSource, float* pTarget, uint64_t count);
+
+} // namespace cesium::omniverse::SimdUtil
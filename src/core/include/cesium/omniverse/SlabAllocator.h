@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace cesium::omniverse {
+
+/**
+ * @brief Allocates objects of a single type from fixed-size slabs and recycles their memory.
+ *
+ * Destroyed objects return their slot to a free list so that later objects reuse the same memory instead of going
+ * back to the heap. Slabs are only freed when the allocator is destroyed, so the allocator must outlive every object
+ * it creates. Objects may be created and destroyed from any thread.
+ */
+template <typename T, size_t SlabSize = 64> class SlabAllocator {
+  public:
+    struct Deleter {
+        SlabAllocator* pAllocator;
+
+        void operator()(T* pObject) const noexcept {
+            pAllocator->destroy(pObject);
+        }
+    };
+
+    using UniquePtr = std::unique_ptr<T, Deleter>;
+
+    SlabAllocator() = default;
+    ~SlabAllocator() = default;
+    SlabAllocator(const SlabAllocator&) = delete;
+    SlabAllocator& operator=(const SlabAllocator&) = delete;
+    SlabAllocator(SlabAllocator&&) noexcept = delete;
+    SlabAllocator& operator=(SlabAllocator&&) noexcept = delete;
+
+    /**
+     * @brief Constructs an object in a free slot. Arguments are forwarded with brace initialization so that
+     * aggregates can be created the same way as with new.
+     */
+    template <typename... Args> T* create(Args&&... args) {
+        const auto pSlot = allocateSlot();
+
+        try {
+            return new (pSlot->storage) T{std::forward<Args>(args)...};
+        } catch (...) {
+            releaseSlot(pSlot);
+            throw;
+        }
+    }
+
+    void destroy(T* pObject) noexcept {
+        if (pObject == nullptr) {
+            return;
+        }
+
+        pObject->~T();
+        releaseSlot(reinterpret_cast<Slot*>(pObject));
+    }
+
+    /**
+     * @brief Takes ownership of an object created by this allocator so that it is destroyed when it goes out of scope.
+     */
+    UniquePtr adopt(T* pObject) {
+        return UniquePtr(pObject, Deleter{this});
+    }
+
+    [[nodiscard]] uint64_t getCapacity() const {
+        std::scoped_lock<std::mutex> lock(_mutex);
+        return _slabs.size() * SlabSize;
+    }
+
+    [[nodiscard]] uint64_t getNumberActive() const {
+        std::scoped_lock<std::mutex> lock(_mutex);
+        return _numberActive;
+    }
+
+  private:
+    union Slot {
+        Slot* pNext;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    Slot* allocateSlot() {
+        std::scoped_lock<std::mutex> lock(_mutex);
+
+        if (_pFreeList == nullptr) {
+            auto pSlab = std::make_unique<Slot[]>(SlabSize);
+
+            for (size_t i = 0; i < SlabSize; ++i) {
+                pSlab[i].pNext = i + 1 < SlabSize ? &pSlab[i + 1] : nullptr;
+            }
+
+            _pFreeList = pSlab.get();
+            _slabs.push_back(std::move(pSlab));
+        }
+
+        const auto pSlot = _pFreeList;
+        _pFreeList = pSlot->pNext;
+        _numberActive++;
+
+        return pSlot;
+    }
+
+    void releaseSlot(Slot* pSlot) noexcept {
+        std::scoped_lock<std::mutex> lock(_mutex);
+        pSlot->pNext = _pFreeList;
+        _pFreeList = pSlot;
+        _numberActive--;
+    }
+
+    mutable std::mutex _mutex;
+    std::vector<std::unique_ptr<Slot[]>> _slabs;
+    Slot* _pFreeList{nullptr};
+    uint64_t _numberActive{0};
+};
+
+} // namespace cesium::omniverse
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace cesium::omniverse {
+
+/**
+ * @brief A map for a handful of entries that keeps them inline and searches them linearly.
+ *
+ * Up to InlineCapacity entries are stored inside the map itself so that small maps never touch the heap. Larger maps
+ * move their entries to a vector. Entries are iterated in insertion order.
+ */
+template <typename Key, typename Value, size_t InlineCapacity = 4> class SmallMap {
+  public:
+    using value_type = std::pair<Key, Value>;
+    using iterator = value_type*;
+    using const_iterator = const value_type*;
+
+    [[nodiscard]] size_t size() const {
+        return _size;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _size == 0;
+    }
+
+    iterator begin() {
+        return data();
+    }
+
+    iterator end() {
+        return data() + _size;
+    }
+
+    const_iterator begin() const {
+        return data();
+    }
+
+    const_iterator end() const {
+        return data() + _size;
+    }
+
+    iterator find(const Key& key) {
+        return std::find_if(begin(), end(), [&key](const value_type& entry) { return entry.first == key; });
+    }
+
+    const_iterator find(const Key& key) const {
+        return std::find_if(begin(), end(), [&key](const value_type& entry) { return entry.first == key; });
+    }
+
+    Value& operator[](const Key& key) {
+        const auto iter = find(key);
+
+        if (iter != end()) {
+            return iter->second;
+        }
+
+        return insert(key, Value{}).second;
+    }
+
+    const Value& at(const Key& key) const {
+        const auto iter = find(key);
+
+        if (iter == end()) {
+            throw std::out_of_range("SmallMap::at: key not found");
+        }
+
+        return iter->second;
+    }
+
+    void clear() {
+        _inlineEntries = {};
+        _heapEntries.clear();
+        _size = 0;
+    }
+
+  private:
+    [[nodiscard]] bool isInline() const {
+        return _size <= InlineCapacity;
+    }
+
+    value_type* data() {
+        return isInline() ? _inlineEntries.data() : _heapEntries.data();
+    }
+
+    const value_type* data() const {
+        return isInline() ? _inlineEntries.data() : _heapEntries.data();
+    }
+
+    value_type& insert(const Key& key, Value&& value) {
+        if (_size < InlineCapacity) {
+            auto& entry = _inlineEntries[_size++];
+            entry = {key, std::move(value)};
+            return entry;
+        }
+
+        if (_size == InlineCapacity) {
+            // Every entry moves to the heap at once so that the entries stay contiguous
+            _heapEntries.reserve(InlineCapacity * 2);
+            std::move(_inlineEntries.begin(), _inlineEntries.end(), std::back_inserter(_heapEntries));
+            _inlineEntries = {};
+        }
+
+        _size++;
+        return _heapEntries.emplace_back(key, std::move(value));
+    }
+
+    std::array<value_type, InlineCapacity> _inlineEntries{};
+    std::vector<value_type> _heapEntries;
+    size_t _size{0};
+};
+
+} // namespace cesium::omniverse
@@ -1,15 +1,171 @@
 #pragma once
 
 #include <CesiumAsync/ITaskProcessor.h>
-#include <pxr/base/work/dispatcher.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace cesium::omniverse {
+
+/**
+ * @brief The lane a task is queued in.
+ *
+ * HIGH, NORMAL, and LOW tasks share the worker threads and higher priority tasks always run first. BLOCKING tasks
+ * are for work that waits on I/O and run on their own threads so that they never occupy a worker thread.
+ */
+enum class TaskPriority {
+    HIGH,
+    NORMAL,
+    LOW,
+    BLOCKING,
+};
+
+/**
+ * @brief Number of buckets in the task timing histograms.
+ *
+ * Bucket 0 counts tasks that took less than 1 microsecond and bucket i counts tasks that took [2^(i-1), 2^i)
+ * microseconds. The last bucket also counts everything longer.
+ */
+constexpr size_t TASK_HISTOGRAM_BUCKET_COUNT = 32;
+
+using TaskHistogram = std::array<uint64_t, TASK_HISTOGRAM_BUCKET_COUNT>;
+
+struct TaskStatistics {
+    uint64_t tasksQueued{0};
+    uint64_t tasksRunning{0};
+    uint64_t tasksCompleted{0};
+    TaskHistogram waitTimeHistogram{};
+    TaskHistogram runTimeHistogram{};
+};
+
+/**
+ * @brief Gets an upper bound for the given percentile of a task timing histogram.
+ *
+ * @param histogram The histogram.
+ * @param percentile The percentile in the range [0, 1].
+ * @returns The upper bound of the bucket containing the percentile in microseconds, or 0 if the histogram is empty.
+ */
+uint64_t getTaskHistogramPercentile(const TaskHistogram& histogram, double percentile);
+
+/**
+ * @brief Sets the priority of tasks started on the current thread for the lifetime of the scope.
+ *
+ * Tasks inherit the priority of the task that started them, so continuations of a high priority task are high
+ * priority too. Continuations of BLOCKING tasks are NORMAL priority.
+ */
+class ScopedTaskPriority {
+  public:
+    explicit ScopedTaskPriority(TaskPriority priority);
+    ~ScopedTaskPriority();
+    ScopedTaskPriority(const ScopedTaskPriority&) = delete;
+    ScopedTaskPriority& operator=(const ScopedTaskPriority&) = delete;
+    ScopedTaskPriority(ScopedTaskPriority&&) noexcept = delete;
+    ScopedTaskPriority& operator=(ScopedTaskPriority&&) noexcept = delete;
+
+  private:
+    TaskPriority _previousPriority;
+};
+
+/**
+ * @brief Work-stealing thread pool.
+ *
+ * Each worker thread has its own queue per priority. Tasks started from a worker thread go to that worker's queue
+ * and tasks started from any other thread go to a shared queue. An idle worker takes the highest priority task it
+ * can find, looking at its own queue first, then the shared queue, then stealing from other workers.
+ */
 class TaskProcessor final : public CesiumAsync::ITaskProcessor {
   public:
+    /**
+     * @brief Creates the thread pool.
+     *
+     * @param workerThreadCount The number of worker threads. If zero, one less than the number of hardware threads
+     * is used so that the main thread keeps a core to itself.
+     */
+    explicit TaskProcessor(uint64_t workerThreadCount);
+    ~TaskProcessor() override;
+    TaskProcessor(const TaskProcessor&) = delete;
+    TaskProcessor& operator=(const TaskProcessor&) = delete;
+    TaskProcessor(TaskProcessor&&) noexcept = delete;
+    TaskProcessor& operator=(TaskProcessor&&) noexcept = delete;
+
     void startTask(std::function<void()> f) override;
 
+    [[nodiscard]] uint64_t getWorkerThreadCount() const;
+
+    /**
+     * @brief Gets the current queue depth and the timing histograms of every task that has run so far.
+     *
+     * Wait time is measured from when a task is started to when a thread begins running it. Run time is how long
+     * the task itself takes.
+     */
+    [[nodiscard]] TaskStatistics getStatistics() const;
+
   private:
-    // TODO: should we being using something in Carbonite instead?
-    pxr::WorkDispatcher _dispatcher;
+    static constexpr size_t PRIORITY_COUNT = 3;
+
+    struct Task {
+        std::function<void()> function;
+        TaskPriority priority{TaskPriority::NORMAL};
+        std::chrono::steady_clock::time_point startTime;
+    };
+
+    struct TaskQueue {
+        std::mutex mutex;
+        std::array<std::deque<Task>, PRIORITY_COUNT> tasks;
+    };
+
+    void runWorker(size_t workerIndex);
+    void runBlockingWorker();
+    [[nodiscard]] bool tryPopTask(size_t workerIndex, Task& task);
+    void runTask(Task& task);
+
+    std::vector<std::unique_ptr<TaskQueue>> _workerQueues;
+    TaskQueue _sharedQueue;
+
+    // Signed because a worker can take a task in the window between startTask publishing it and counting it, which
+    // briefly takes the count below zero
+    int64_t _queuedTaskCount{0};
+    std::mutex _wakeMutex;
+    std::condition_variable _wakeCondition;
+
+    std::mutex _blockingMutex;
+    std::condition_variable _blockingCondition;
+    std::deque<Task> _blockingTasks;
+
+    std::atomic<uint64_t> _tasksQueued{0};
+    std::atomic<uint64_t> _tasksRunning{0};
+    std::atomic<uint64_t> _tasksCompleted{0};
+    std::array<std::atomic<uint64_t>, TASK_HISTOGRAM_BUCKET_COUNT> _waitTimeHistogram{};
+    std::array<std::atomic<uint64_t>, TASK_HISTOGRAM_BUCKET_COUNT> _runTimeHistogram{};
+
+    bool _stopping{false};
+    std::vector<std::thread> _workerThreads;
+    std::vector<std::thread> _blockingThreads;
 };
+
+/**
+ * @brief Gets the number of lanes that {@link runParallel} can run at once on the calling thread.
+ *
+ * This is the worker thread count of the TaskProcessor when called from one of its worker threads and 1 otherwise.
+ */
+[[nodiscard]] uint64_t getParallelLaneCount();
+
+/**
+ * @brief Runs f once for every lane index in [0, laneCount) and returns once all of them have finished.
+ *
+ * When called from a worker thread the lanes are started as tasks on the same TaskProcessor and the calling thread
+ * runs lanes as well, so it only ever waits on lanes that are already running and a busy pool can't deadlock it.
+ * Anywhere else the lanes run one after another on the calling thread. f must not throw.
+ */
+void runParallel(uint64_t laneCount, const std::function<void(uint64_t laneIndex)>& f);
+
 } // namespace cesium::omniverse
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace cesium::omniverse::UriUtil {
+
+/**
+ * @brief Converts a URI that names a local file, like file:///path/to/file, to a native path.
+ *
+ * @param uri The URI.
+ * @param scheme The scheme the URI must have, including the "://" separator.
+ * @returns The percent-decoded path, or nullopt if the URI has a different scheme or names a file on another host.
+ */
+std::optional<std::filesystem::path> getLocalPath(const std::string& uri, std::string_view scheme);
+
+/**
+ * @brief Gets the part of a URL before its query or fragment.
+ */
+std::string_view getUrlPath(std::string_view url);
+
+/**
+ * @brief Strips the query, fragment and any leading ./, ../ or / segments from a relative URI so that it can be
+ * matched against the end of a resolved URL path with {@link endsWithPathSuffix}.
+ */
+std::string_view normalizeUrlSuffix(std::string_view suffix);
+
+/**
+ * @brief Gets the last segment of a URL path.
+ */
+std::string_view getFileName(std::string_view path);
+
+/**
+ * @brief Checks whether a URL path ends with a normalized suffix at a segment boundary.
+ */
+bool endsWithPathSuffix(std::string_view path, std::string_view suffix);
+
+} // namespace cesium::omniverse::UriUtil
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <gsl/span>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cesium::omniverse {
+
+class MemoryMappedFile;
+
+/**
+ * @brief Read-only random access to the entries of a zip archive, such as a 3D Tiles archive (.3tz).
+ *
+ * The central directory is indexed once when the archive is opened. Entries are read straight out of a memory
+ * mapping of the archive, so reading an entry never touches the filesystem metadata. Stored and deflated entries
+ * are supported, as are ZIP64 archives. All methods are safe to call from any thread.
+ */
+class ZipArchive {
+  public:
+    /**
+     * @brief Opens the archive at the given path and indexes its central directory.
+     *
+     * @param path The path of the archive.
+     * @returns The archive, or nullptr if the file couldn't be opened or isn't a valid zip archive.
+     */
+    [[nodiscard]] static std::shared_ptr<ZipArchive> open(const std::filesystem::path& path);
+
+    ~ZipArchive();
+    ZipArchive(const ZipArchive&) = delete;
+    ZipArchive& operator=(const ZipArchive&) = delete;
+    ZipArchive(ZipArchive&&) noexcept = delete;
+    ZipArchive& operator=(ZipArchive&&) noexcept = delete;
+
+    [[nodiscard]] bool contains(const std::string& entryName) const;
+    [[nodiscard]] size_t getEntryCount() const;
+
+    /**
+     * @brief Gets the raw bytes of an entry that is stored without compression.
+     *
+     * @returns A span into the archive's mapping, or nullopt if the entry doesn't exist or is compressed.
+     */
+    [[nodiscard]] std::optional<gsl::span<const std::byte>> getStoredEntry(const std::string& entryName) const;
+
+    /**
+     * @brief Reads and decompresses an entry.
+     *
+     * @returns The entry's contents, or nullopt if the entry doesn't exist or can't be decompressed.
+     */
+    [[nodiscard]] std::optional<std::vector<std::byte>> readEntry(const std::string& entryName) const;
+
+  private:
+    struct Entry {
+        uint16_t compressionMethod;
+        uint64_t compressedSize;
+        uint64_t uncompressedSize;
+        uint64_t localHeaderOffset;
+    };
+
+    ZipArchive(std::unique_ptr<MemoryMappedFile>&& pFile, std::unordered_map<std::string, Entry>&& entries);
+
+    [[nodiscard]] std::optional<gsl::span<const std::byte>> getCompressedData(const Entry& entry) const;
+
+    std::unique_ptr<MemoryMappedFile> _pFile;
+    std::unordered_map<std::string, Entry> _entries;
+};
+
+} // namespace cesium::omniverse
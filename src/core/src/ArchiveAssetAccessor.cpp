@@ -0,0 +1,254 @@
+#include "cesium/omniverse/ArchiveAssetAccessor.h"
+
+#include "cesium/omniverse/LoggerSink.h"
+#include "cesium/omniverse/TaskProcessor.h"
+#include "cesium/omniverse/UriUtil.h"
+#include "cesium/omniverse/ZipArchive.h"
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/IAssetRequest.h>
+#include <CesiumAsync/IAssetResponse.h>
+
+#include <algorithm>
+#include <cctype>
+#include <optional>
+#include <string_view>
+
+namespace cesium::omniverse {
+
+namespace {
+
+const std::string_view FILE_SCHEME = "file://";
+const std::string_view ARCHIVE_EXTENSION = ".3tz";
+const char* ROOT_TILESET_ENTRY = "tileset.json";
+
+class ArchiveAssetResponse final : public CesiumAsync::IAssetResponse {
+  public:
+    ArchiveAssetResponse(uint16_t statusCode) noexcept
+        : _statusCode(statusCode) {}
+
+    ArchiveAssetResponse(std::shared_ptr<ZipArchive>&& pArchive, gsl::span<const std::byte> storedData) noexcept
+        : _statusCode(200)
+        , _pArchive(std::move(pArchive))
+        , _storedData(storedData) {}
+
+    ArchiveAssetResponse(std::vector<std::byte>&& uncompressedData) noexcept
+        : _statusCode(200)
+        , _uncompressedData(std::move(uncompressedData)) {}
+
+    [[nodiscard]] uint16_t statusCode() const override {
+        return _statusCode;
+    }
+
+    [[nodiscard]] std::string contentType() const override {
+        return "";
+    }
+
+    [[nodiscard]] const CesiumAsync::HttpHeaders& headers() const override {
+        return _headers;
+    }
+
+    [[nodiscard]] gsl::span<const std::byte> data() const override {
+        if (_pArchive) {
+            return _storedData;
+        }
+
+        return {_uncompressedData.data(), _uncompressedData.size()};
+    }
+
+  private:
+    uint16_t _statusCode;
+    CesiumAsync::HttpHeaders _headers;
+
+    // Stored entries point into the archive's mapping, which the response keeps alive
+    std::shared_ptr<ZipArchive> _pArchive;
+    gsl::span<const std::byte> _storedData;
+    std::vector<std::byte> _uncompressedData;
+};
+
+class ArchiveAssetRequest final : public CesiumAsync::IAssetRequest {
+  public:
+    ArchiveAssetRequest(
+        std::string url,
+        const std::vector<CesiumAsync::IAssetAccessor::THeader>& headers,
+        ArchiveAssetResponse&& response)
+        : _method{"GET"}
+        , _url{std::move(url)}
+        , _headers{headers.begin(), headers.end()}
+        , _response{std::move(response)} {}
+
+    [[nodiscard]] const std::string& method() const override {
+        return _method;
+    }
+
+    [[nodiscard]] const std::string& url() const override {
+        return _url;
+    }
+
+    [[nodiscard]] const CesiumAsync::HttpHeaders& headers() const override {
+        return _headers;
+    }
+
+    [[nodiscard]] const CesiumAsync::IAssetResponse* response() const override {
+        return &_response;
+    }
+
+  private:
+    std::string _method;
+    std::string _url;
+    CesiumAsync::HttpHeaders _headers;
+    ArchiveAssetResponse _response;
+};
+
+struct ArchiveLocation {
+    std::string archivePath;
+    std::string entryName;
+};
+
+// Returns nullopt if the path doesn't point into an archive
+std::optional<ArchiveLocation> splitArchivePath(const std::string& path) {
+    auto lowercasePath = path;
+    std::transform(lowercasePath.begin(), lowercasePath.end(), lowercasePath.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+
+    const auto separator = lowercasePath.find(std::string(ARCHIVE_EXTENSION) + "/");
+
+    if (separator == std::string::npos) {
+        // A bare archive path refers to the root tileset
+        if (lowercasePath.size() > ARCHIVE_EXTENSION.size() &&
+            lowercasePath.compare(
+                lowercasePath.size() - ARCHIVE_EXTENSION.size(), ARCHIVE_EXTENSION.size(), ARCHIVE_EXTENSION) == 0) {
+            return ArchiveLocation{path, ROOT_TILESET_ENTRY};
+        }
+
+        return std::nullopt;
+    }
+
+    const auto entryStart = separator + ARCHIVE_EXTENSION.size() + 1;
+    return ArchiveLocation{path.substr(0, entryStart - 1), path.substr(entryStart)};
+}
+
+} // namespace
+
+ArchiveAssetAccessor::ArchiveAssetAccessor(const std::shared_ptr<CesiumAsync::IAssetAccessor>& assetAccessor)
+    : _assetAccessor(assetAccessor) {}
+
+CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> ArchiveAssetAccessor::get(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    const std::string& url,
+    const std::vector<THeader>& headers) {
+    const auto localPath = UriUtil::getLocalPath(url, FILE_SCHEME);
+
+    if (!localPath.has_value()) {
+        return _assetAccessor->get(asyncSystem, url, headers);
+    }
+
+    const auto path = localPath->generic_u8string();
+    auto location = splitArchivePath(path);
+
+    if (!location.has_value()) {
+        return _assetAccessor->get(asyncSystem, url, headers);
+    }
+
+    // Relative URLs in the root tileset are resolved against the URL of its request, so a bare archive URL is
+    // reported as the URL of the root tileset inside it
+    auto requestUrl = url;
+    if (location->archivePath == path) {
+        const auto urlPath = UriUtil::getUrlPath(url);
+        const auto urlSuffix = std::string_view(url).substr(urlPath.size());
+        requestUrl = fmt::format("{}/{}{}", urlPath, ROOT_TILESET_ENTRY, urlSuffix);
+    }
+
+    // The first request for an archive blocks on disk while the central directory is indexed
+    ScopedTaskPriority scopedPriority(TaskPriority::BLOCKING);
+
+    return asyncSystem.runInWorkerThread([weakThis = weak_from_this(),
+                                          requestUrl = std::move(requestUrl),
+                                          headers,
+                                          location = std::move(location.value())]() {
+        const auto makeRequest = [&requestUrl, &headers](ArchiveAssetResponse&& response) {
+            return std::shared_ptr<CesiumAsync::IAssetRequest>(
+                std::make_shared<ArchiveAssetRequest>(requestUrl, headers, std::move(response)));
+        };
+
+        const auto pThis = weakThis.lock();
+
+        if (!pThis) {
+            // The accessor was destroyed before the request started
+            return makeRequest(ArchiveAssetResponse(503));
+        }
+
+        auto pArchive = pThis->getArchive(location.archivePath);
+
+        if (!pArchive || !pArchive->contains(location.entryName)) {
+            return makeRequest(ArchiveAssetResponse(404));
+        }
+
+        const auto storedData = pArchive->getStoredEntry(location.entryName);
+
+        if (storedData.has_value()) {
+            return makeRequest(ArchiveAssetResponse(std::move(pArchive), storedData.value()));
+        }
+
+        auto uncompressedData = pArchive->readEntry(location.entryName);
+
+        if (!uncompressedData.has_value()) {
+            CESIUM_LOG_ERROR("Could not read {} from archive {}", location.entryName, location.archivePath);
+            return makeRequest(ArchiveAssetResponse(500));
+        }
+
+        return makeRequest(ArchiveAssetResponse(std::move(uncompressedData.value())));
+    });
+}
+
+CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> ArchiveAssetAccessor::request(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    const std::string& verb,
+    const std::string& url,
+    const std::vector<THeader>& headers,
+    const gsl::span<const std::byte>& contentPayload) {
+    if (verb == "GET") {
+        return get(asyncSystem, url, headers);
+    }
+
+    return _assetAccessor->request(asyncSystem, verb, url, headers, contentPayload);
+}
+
+void ArchiveAssetAccessor::tick() noexcept {
+    _assetAccessor->tick();
+}
+
+std::shared_ptr<ZipArchive> ArchiveAssetAccessor::getArchive(const std::string& archivePath) {
+    std::shared_ptr<ArchiveSlot> pSlot;
+
+    {
+        std::scoped_lock<std::mutex> lock(_archivesMutex);
+
+        auto& pExistingSlot = _archives[archivePath];
+
+        if (!pExistingSlot) {
+            pExistingSlot = std::make_shared<ArchiveSlot>();
+        }
+
+        pSlot = pExistingSlot;
+    }
+
+    // Concurrent requests for the same archive wait here while the first one indexes it
+    std::scoped_lock<std::mutex> lock(pSlot->mutex);
+
+    if (pSlot->pArchive) {
+        return pSlot->pArchive;
+    }
+
+    pSlot->pArchive = ZipArchive::open(std::filesystem::u8path(archivePath));
+
+    if (!pSlot->pArchive) {
+        // Left empty so that the archive can be fixed and retried without restarting
+        CESIUM_LOG_ERROR("Could not open archive {}", archivePath);
+    }
+
+    return pSlot->pArchive;
+}
+
+} // namespace cesium::omniverse
@@ -1,10 +1,12 @@
 #include "cesium/omniverse/Context.h"
 
+#include "cesium/omniverse/ArchiveAssetAccessor.h"
 #include "cesium/omniverse/AssetRegistry.h"
 #include "cesium/omniverse/Broadcast.h"
 #include "cesium/omniverse/CesiumIonSession.h"
 #include "cesium/omniverse/FabricResourceManager.h"
 #include "cesium/omniverse/FabricUtil.h"
+#include "cesium/omniverse/FileAssetAccessor.h"
 #include "cesium/omniverse/GeospatialUtil.h"
 #include "cesium/omniverse/GlobeAnchorRegistry.h"
 #include "cesium/omniverse/HttpAssetAccessor.h"
@@ -12,7 +14,10 @@
 #include "cesium/omniverse/OmniGlobeAnchor.h"
 #include "cesium/omniverse/OmniImagery.h"
 #include "cesium/omniverse/OmniTileset.h"
+#include "cesium/omniverse/RecordingAssetAccessor.h"
+#include "cesium/omniverse/ReplayAssetAccessor.h"
 #include "cesium/omniverse/SessionRegistry.h"
+#include "cesium/omniverse/SettingsWrapper.h"
 #include "cesium/omniverse/TaskProcessor.h"
 #include "cesium/omniverse/Tokens.h"
 #include "cesium/omniverse/UsdUtil.h"
@@ -24,15 +29,19 @@
 
 #include <Cesium3DTilesContent/registerAllTileContentTypes.h>
 #include <Cesium3DTilesSelection/Tileset.h>
+#include <CesiumAsync/CachingAssetAccessor.h>
+#include <CesiumAsync/SqliteCacheDatabase.h>
 #include <CesiumUsdSchemas/tokens.h>
 #include <CesiumUtility/CreditSystem.h>
+#include <carb/tokens/TokensUtils.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usdUtils/stageCache.h>
 
-#if CESIUM_TRACING_ENABLED
+#include <algorithm>
 #include <chrono>
-#endif
+#include <exception>
+#include <system_error>
 
 namespace cesium::omniverse {
 
@@ -40,6 +49,48 @@ namespace {
 
 std::unique_ptr<Context> context;
 
+// Smallest time limit handed to a tileset, in milliseconds
+const double MIN_LOADING_TIME_LIMIT = 0.001;
+
+const char* CACHE_DIRECTORY_TOKEN = "${omni_cache}";
+
+std::filesystem::path getCacheDirectory() {
+    // The extension's own directory is often read-only, so the cache goes in the user's Omniverse cache directory
+    const auto pTokens = carb::getCachedInterface<carb::tokens::ITokens>();
+
+    if (pTokens) {
+        const auto cacheDirectory = carb::tokens::resolveString(pTokens, CACHE_DIRECTORY_TOKEN);
+        if (!cacheDirectory.empty() && cacheDirectory != CACHE_DIRECTORY_TOKEN) {
+            return std::filesystem::path(cacheDirectory) / "cesium.omniverse";
+        }
+    }
+
+    std::error_code errorCode;
+    return std::filesystem::temp_directory_path(errorCode) / "cesium.omniverse";
+}
+
+std::shared_ptr<CesiumAsync::ICacheDatabase> createCacheDatabase(const std::shared_ptr<spdlog::logger>& logger) {
+    const auto cacheDirectory = getCacheDirectory();
+
+    std::error_code errorCode;
+    std::filesystem::create_directories(cacheDirectory, errorCode);
+
+    if (errorCode) {
+        logger->warn("Request cache disabled. Could not create {}: {}", cacheDirectory.string(), errorCode.message());
+        return nullptr;
+    }
+
+    const auto cacheDatabasePath = cacheDirectory / "cesium-request-cache.sqlite";
+
+    try {
+        return std::make_shared<CesiumAsync::SqliteCacheDatabase>(
+            logger, cacheDatabasePath.string(), Settings::getMaxCacheItems());
+    } catch (const std::exception& e) {
+        logger->warn("Request cache disabled. Could not open {}: {}", cacheDatabasePath.string(), e.what());
+        return nullptr;
+    }
+}
+
 } // namespace
 
 void Context::onStartup(const std::filesystem::path& cesiumExtensionLocation) {
@@ -78,11 +129,6 @@ void Context::initialize(int64_t contextId, const std::filesystem::path& cesiumE
     const auto cesiumMdlPath = _cesiumExtensionLocation / "mdl" / "cesium.mdl";
     _cesiumMdlPathToken = pxr::TfToken(cesiumMdlPath.generic_string());
 
-    _taskProcessor = std::make_shared<TaskProcessor>();
-    _asyncSystem = std::make_shared<CesiumAsync::AsyncSystem>(_taskProcessor);
-    _httpAssetAccessor = std::make_shared<HttpAssetAccessor>(_certificatePath);
-    _creditSystem = std::make_shared<CesiumUtility::CreditSystem>();
-
     _logger = std::make_shared<spdlog::logger>(
         std::string("cesium-omniverse"),
         spdlog::sinks_init_list{
@@ -93,6 +139,50 @@ void Context::initialize(int64_t contextId, const std::filesystem::path& cesiumE
             std::make_shared<LoggerSink>(omni::log::Level::eFatal),
         });
 
+    _taskProcessor = std::make_shared<TaskProcessor>(Settings::getWorkerThreadCount());
+    _asyncSystem = std::make_shared<CesiumAsync::AsyncSystem>(_taskProcessor);
+    _httpAssetAccessor = std::make_shared<HttpAssetAccessor>(_certificatePath);
+    _creditSystem = std::make_shared<CesiumUtility::CreditSystem>();
+
+    // Tile and imagery responses go through a persistent SQLite cache so that they survive across sessions.
+    // The cache honors Cache-Control / Expires and evicts the least recently accessed items once the cap is reached.
+    // Ion session requests bypass the cache since they are authenticated and short-lived. If the cache can't be
+    // opened, requests go straight to the network.
+    std::shared_ptr<CesiumAsync::IAssetAccessor> networkAssetAccessor = _httpAssetAccessor;
+    const auto cacheDatabase = createCacheDatabase(_logger);
+
+    if (cacheDatabase) {
+        networkAssetAccessor = std::make_shared<CesiumAsync::CachingAssetAccessor>(
+            _logger,
+            _httpAssetAccessor,
+            cacheDatabase,
+            static_cast<int32_t>(Settings::getRequestsPerCachePrune()));
+    }
+
+    // Local tilesets and 3D Tiles archives are memory mapped instead of going through curl and the cache. Archives
+    // are file:// URLs too, so they are checked first.
+    const auto fileAssetAccessor = std::make_shared<FileAssetAccessor>(networkAssetAccessor);
+    _assetAccessor = std::make_shared<ArchiveAssetAccessor>(fileAssetAccessor);
+
+    // Tile and imagery requests can be recorded to an archive and replayed later for reproducible benchmarks.
+    // Replay serves every request from the archive so that the network and the cache are taken out of the picture.
+    const auto requestArchiveMode = Settings::getRequestArchiveMode();
+    const auto requestArchivePathSetting = Settings::getRequestArchivePath();
+    const auto requestArchivePath = requestArchivePathSetting.empty()
+                                        ? _cesiumExtensionLocation / "cesium-request-archive.bin"
+                                        : std::filesystem::path(requestArchivePathSetting);
+
+    if (requestArchiveMode == "record") {
+        _assetAccessor = std::make_shared<RecordingAssetAccessor>(_assetAccessor, requestArchivePath);
+    } else if (requestArchiveMode == "replay") {
+        _assetAccessor = std::make_shared<ReplayAssetAccessor>(
+            requestArchivePath,
+            static_cast<double>(Settings::getReplayLatencyMilliseconds()) / 1000.0,
+            Settings::getReplayBandwidthMegabitsPerSecond() * 1000000.0 / 8.0);
+    } else if (!requestArchiveMode.empty()) {
+        CESIUM_LOG_WARN("Unknown request archive mode: {}", requestArchiveMode);
+    }
+
     Cesium3DTilesContent::registerAllTileContentTypes();
 
 #if CESIUM_TRACING_ENABLED
@@ -117,6 +207,10 @@ std::shared_ptr<HttpAssetAccessor> Context::getHttpAssetAccessor() {
     return _httpAssetAccessor;
 }
 
+std::shared_ptr<CesiumAsync::IAssetAccessor> Context::getAssetAccessor() {
+    return _assetAccessor;
+}
+
 std::shared_ptr<CesiumUtility::CreditSystem> Context::getCreditSystem() {
     return _creditSystem;
 }
@@ -199,6 +293,9 @@ void Context::reloadStage() {
 }
 
 void Context::onUpdateFrame(const std::vector<Viewport>& viewports) {
+    // Complete replayed requests. HTTP transfers run on their own thread and don't need ticking.
+    _assetAccessor->tick();
+
     processUsdNotifications();
 
     const auto georeferenceOrigin = Context::instance().getGeoreferenceOrigin();
@@ -214,10 +311,75 @@ void Context::onUpdateFrame(const std::vector<Viewport>& viewports) {
         cesiumSession.GetEcefToUsdTransformAttr().Set(pxr::VtValue(UsdUtil::glmToUsdMatrix(ecefToUsdTransform)));
     }
 
+    // Grow pools here so that tiles loading in worker threads don't have to wait for the main thread to do it
+    FabricResourceManager::getInstance().reservePoolCapacity();
+
+    updateTilesets(viewports);
+}
+
+void Context::updateTilesets(const std::vector<Viewport>& viewports) {
     const auto& tilesets = AssetRegistry::getInstance().getAllTilesets();
-    for (const auto& tileset : tilesets) {
+    const auto budget = Settings::getMainThreadLoadingBudgetMilliseconds();
+
+    // Takes effect when pending geometries are written below. Point clouds are only budgeted if they were loaded while
+    // the budget was enabled, so tilesets with point clouds are reloaded when it is turned on or off. Tilesets without
+    // them aren't affected by the budget.
+    auto& fabricResourceManager = FabricResourceManager::getInstance();
+    const auto pointBudget = Settings::getPointBudget();
+    const auto pointBudgetToggled = (pointBudget > 0) != (fabricResourceManager.getPointBudget() > 0);
+    fabricResourceManager.setPointBudget(pointBudget);
+
+    if (pointBudgetToggled) {
+        for (const auto& tileset : tilesets) {
+            if (tileset->hasPointContent()) {
+                tileset->reload();
+            }
+        }
+    }
+
+    if (budget == 0.0) {
+        _mainThreadLoadingDebt = 0.0;
+
+        for (const auto& tileset : tilesets) {
+            tileset->setMainThreadLoadingBudget(0.0);
+            tileset->onUpdateFrame(viewports);
+        }
+
+        fabricResourceManager.writePendingGeometries(0.0);
+        return;
+    }
+
+    // Tilesets whose waiting tiles had the largest screen space error last frame go first. Each tileset gets an
+    // even share of whatever budget is left so that time a tileset doesn't use goes to the ones after it.
+    std::vector<std::shared_ptr<OmniTileset>> sortedTilesets(tilesets.begin(), tilesets.end());
+    std::stable_sort(sortedTilesets.begin(), sortedTilesets.end(), [](const auto& a, const auto& b) {
+        return a->getMainThreadLoadScreenSpaceError() > b->getMainThreadLoadScreenSpaceError();
+    });
+
+    // Time spent over budget last frame is taken out of this frame's budget
+    auto remainingBudget = budget - _mainThreadLoadingDebt;
+    auto remainingTilesets = sortedTilesets.size();
+
+    for (const auto& tileset : sortedTilesets) {
+        // cesium-native treats a limit of zero as no limit. It always finishes at least one tile per update, so an
+        // exhausted budget still lets every tileset make progress.
+        const auto share = std::max(remainingBudget / static_cast<double>(remainingTilesets), MIN_LOADING_TIME_LIMIT);
+        tileset->setMainThreadLoadingBudget(share);
         tileset->onUpdateFrame(viewports);
+
+        remainingBudget -= tileset->getMainThreadLoadingTime();
+        remainingTilesets--;
     }
+
+    // Geometry from every tileset's newly loaded tiles is written in batches until the budget runs out, which counts
+    // against the budget too. The rest stays queued for the next frame.
+    const auto writeStartTime = std::chrono::steady_clock::now();
+    fabricResourceManager.writePendingGeometries(std::max(remainingBudget, MIN_LOADING_TIME_LIMIT));
+    const auto writeTime = std::chrono::steady_clock::now() - writeStartTime;
+    remainingBudget -= std::chrono::duration<double, std::milli>(writeTime).count();
+
+    // Carrying over more than one frame's budget would stall loading for several frames after a single slow tile
+    _mainThreadLoadingDebt = std::clamp(-remainingBudget, 0.0, budget);
 }
 
 void Context::processPropertyChanged(const ChangedPrim& changedPrim) {
@@ -290,6 +452,9 @@ void Context::processCesiumTilesetChanged(const ChangedPrim& changedPrim) {
         name == pxr::CesiumTokens->cesiumIonAccessToken ||
         name == pxr::CesiumTokens->cesiumIonServerBinding ||
         name == pxr::CesiumTokens->cesiumSmoothNormals ||
+        name == pxr::CesiumTokens->cesiumWeldNormals ||
+        name == pxr::CesiumTokens->cesiumRenderPointsAsCubes ||
+        name == pxr::CesiumTokens->cesiumOptimizeMeshes ||
         name == pxr::CesiumTokens->cesiumShowCreditsOnScreen ||
         name == pxr::UsdTokens->material_binding) {
         tileset.value()->reload();
@@ -970,6 +1135,26 @@ RenderStatistics Context::getRenderStatistics() const {
         renderStatistics.tilesLoaded += tilesetStatistics.tilesLoaded;
     }
 
+    const auto httpStatistics = _httpAssetAccessor->getStatistics();
+    renderStatistics.httpRequestsCompleted = httpStatistics.requestsCompleted;
+    renderStatistics.httpConnectionsOpened = httpStatistics.connectionsOpened;
+    renderStatistics.http2RequestsCompleted = httpStatistics.http2RequestsCompleted;
+    renderStatistics.http2ConnectionsOpened = httpStatistics.http2ConnectionsOpened;
+    renderStatistics.httpRequestsCoalesced = httpStatistics.requestsCoalesced;
+
+    const auto taskStatistics = _taskProcessor->getStatistics();
+    renderStatistics.tasksQueued = taskStatistics.tasksQueued;
+    renderStatistics.tasksRunning = taskStatistics.tasksRunning;
+    renderStatistics.tasksCompleted = taskStatistics.tasksCompleted;
+    renderStatistics.taskWaitTimeP50Microseconds = getTaskHistogramPercentile(taskStatistics.waitTimeHistogram, 0.5);
+    renderStatistics.taskWaitTimeP99Microseconds = getTaskHistogramPercentile(taskStatistics.waitTimeHistogram, 0.99);
+    renderStatistics.taskRunTimeP50Microseconds = getTaskHistogramPercentile(taskStatistics.runTimeHistogram, 0.5);
+    renderStatistics.taskRunTimeP99Microseconds = getTaskHistogramPercentile(taskStatistics.runTimeHistogram, 0.99);
+    renderStatistics.taskWaitTimeHistogram.assign(
+        taskStatistics.waitTimeHistogram.begin(), taskStatistics.waitTimeHistogram.end());
+    renderStatistics.taskRunTimeHistogram.assign(
+        taskStatistics.runTimeHistogram.begin(), taskStatistics.runTimeHistogram.end());
+
     return renderStatistics;
 }
 
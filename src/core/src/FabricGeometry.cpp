@@ -18,8 +18,15 @@
 #endif
 
 #include <CesiumGltf/Model.h>
+#include <CesiumUtility/Tracing.h>
+#include <meshoptimizer.h>
 #include <omni/fabric/FabricUSD.h>
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <unordered_map>
+
 namespace cesium::omniverse {
 
 namespace {
@@ -32,21 +39,396 @@ const auto DEFAULT_SCALE = pxr::GfVec3f(1.0f, 1.0f, 1.0f);
 const auto DEFAULT_MATRIX = pxr::GfMatrix4d(1.0);
 const auto DEFAULT_VISIBILITY = false;
 
+// Below this many prims it's faster to write each prim directly than to find the buckets they live in
+const size_t MIN_BATCH_SIZE = 16;
+
+// Points are drawn the same size as the cubes that are used when the tileset renders points as cubes
+const auto POINT_WIDTH = 3.0f;
+const auto CUBE_HALF_SIZE = POINT_WIDTH * 0.5f;
+
+// How much worse the vertex cache may get while triangles are reordered to reduce overdraw
+const auto OVERDRAW_THRESHOLD = 1.05f;
+
+using Staging = FabricGeometryStaging;
+using BucketStagings = std::vector<std::pair<size_t, const Staging*>>;
+
 template <DataType T>
-void setVertexAttributeValues(
-    omni::fabric::StageReaderWriter& srw,
-    const omni::fabric::Path& path,
+void stageVertexAttributeValues(
     const CesiumGltf::Model& model,
     const CesiumGltf::MeshPrimitive& primitive,
     const VertexAttributeInfo& attribute,
-    uint64_t repeat) {
+    uint64_t repeat,
+    std::vector<std::byte>& values) {
+    using NativeType = GetNativeType<getPrimvarType<T>()>;
 
     const auto accessor = GltfUtil::getVertexAttributeValues<T>(model, primitive, attribute.gltfAttributeName);
     assert(accessor.size() > 0);
-    srw.setArrayAttributeSize(path, attribute.fabricAttributeName, accessor.size() * repeat);
-    auto fabricValues =
-        srw.getArrayAttributeWr<GetNativeType<getPrimvarType<T>()>>(path, attribute.fabricAttributeName);
-    accessor.fill(fabricValues, repeat);
+    const auto count = accessor.size() * repeat;
+    values.resize(count * sizeof(NativeType));
+    accessor.fill(gsl::span<NativeType>(reinterpret_cast<NativeType*>(values.data()), count), repeat);
+}
+
+template <DataType T>
+void resizeVertexAttributeValues(
+    omni::fabric::StageReaderWriter& srw,
+    const omni::fabric::Path& path,
+    const VertexAttributeInfo& attribute,
+    const std::vector<std::byte>& values) {
+    using NativeType = GetNativeType<getPrimvarType<T>()>;
+
+    srw.setArrayAttributeSize(path, attribute.fabricAttributeName, values.size() / sizeof(NativeType));
+}
+
+template <DataType T>
+void writeVertexAttributeValues(
+    omni::fabric::StageReaderWriter& srw,
+    const omni::fabric::Path& path,
+    const VertexAttributeInfo& attribute,
+    const std::vector<std::byte>& values) {
+    using NativeType = GetNativeType<getPrimvarType<T>()>;
+
+    auto fabricValues = srw.getArrayAttributeWr<NativeType>(path, attribute.fabricAttributeName);
+    std::memcpy(fabricValues.data(), values.data(), values.size());
+}
+
+template <DataType T>
+void writeVertexAttributeValueArrays(
+    omni::fabric::StageReaderWriter& srw,
+    const omni::fabric::PrimBucketList& buckets,
+    size_t bucketId,
+    const VertexAttributeInfo& attribute,
+    const BucketStagings& bucketStagings,
+    uint64_t customVertexAttributeIndex) {
+    using NativeType = GetNativeType<getPrimvarType<T>()>;
+
+    auto fabricValues = srw.getArrayAttributeArrayWr<NativeType>(buckets, bucketId, attribute.fabricAttributeName);
+    for (const auto& [i, pStaging] : bucketStagings) {
+        const auto& values = pStaging->customVertexAttributes[customVertexAttributeIndex];
+        std::memcpy(fabricValues[i].data(), values.data(), values.size());
+    }
+}
+
+template <typename T>
+void writeArray(
+    omni::fabric::StageReaderWriter& srw,
+    const omni::fabric::Path& path,
+    const omni::fabric::Token& attributeName,
+    const std::vector<T>& values) {
+    auto fabricValues = srw.getArrayAttributeWr<T>(path, attributeName);
+    std::copy(values.begin(), values.end(), fabricValues.begin());
+}
+
+template <typename T>
+void writeArrays(
+    omni::fabric::StageReaderWriter& srw,
+    const omni::fabric::PrimBucketList& buckets,
+    size_t bucketId,
+    const omni::fabric::Token& attributeName,
+    const BucketStagings& bucketStagings,
+    std::vector<T> Staging::*member) {
+    auto fabricValues = srw.getArrayAttributeArrayWr<T>(buckets, bucketId, attributeName);
+    for (const auto& [i, pStaging] : bucketStagings) {
+        const auto& values = pStaging->*member;
+        std::copy(values.begin(), values.end(), fabricValues[i].begin());
+    }
+}
+
+void resizeArrays(
+    omni::fabric::StageReaderWriter& srw,
+    const omni::fabric::Path& path,
+    const FabricGeometryDefinition& geometryDefinition,
+    const FabricGeometryStaging& staging) {
+    if (geometryDefinition.isPoints()) {
+        srw.setArrayAttributeSize(path, FabricTokens::widths, staging.widths.size());
+    } else {
+        srw.setArrayAttributeSize(path, FabricTokens::faceVertexCounts, staging.faceVertexCounts.size());
+        srw.setArrayAttributeSize(path, FabricTokens::faceVertexIndices, staging.faceVertexIndices.size());
+    }
+
+    srw.setArrayAttributeSize(path, FabricTokens::points, staging.points.size());
+
+    for (uint64_t i = 0; i < geometryDefinition.getTexcoordSetCount(); i++) {
+        srw.setArrayAttributeSize(path, FabricTokens::primvars_st_n(i), staging.texcoords[i].size());
+    }
+
+    if (geometryDefinition.hasNormals()) {
+        srw.setArrayAttributeSize(path, FabricTokens::primvars_normals, staging.normals.size());
+    }
+
+    if (geometryDefinition.hasVertexColors()) {
+        srw.setArrayAttributeSize(path, FabricTokens::primvars_COLOR_0, staging.vertexColors.size());
+    }
+
+    if (geometryDefinition.hasVertexIds()) {
+        srw.setArrayAttributeSize(path, FabricTokens::primvars_vertexId, staging.vertexIds.size());
+    }
+
+    uint64_t customVertexAttributeIndex = 0;
+    for (const auto& customVertexAttribute : geometryDefinition.getCustomVertexAttributes()) {
+        CALL_TEMPLATED_FUNCTION_WITH_RUNTIME_DATA_TYPE(
+            resizeVertexAttributeValues,
+            customVertexAttribute.type,
+            srw,
+            path,
+            customVertexAttribute,
+            staging.customVertexAttributes[customVertexAttributeIndex++]);
+    }
+}
+
+void writeGeometry(
+    omni::fabric::StageReaderWriter& srw,
+    const omni::fabric::Path& path,
+    const FabricGeometryDefinition& geometryDefinition,
+    const FabricGeometryStaging& staging) {
+    resizeArrays(srw, path, geometryDefinition, staging);
+
+    if (geometryDefinition.isPoints()) {
+        writeArray(srw, path, FabricTokens::widths, staging.widths);
+    } else {
+        writeArray(srw, path, FabricTokens::faceVertexCounts, staging.faceVertexCounts);
+        writeArray(srw, path, FabricTokens::faceVertexIndices, staging.faceVertexIndices);
+    }
+
+    writeArray(srw, path, FabricTokens::points, staging.points);
+
+    for (uint64_t i = 0; i < geometryDefinition.getTexcoordSetCount(); i++) {
+        writeArray(srw, path, FabricTokens::primvars_st_n(i), staging.texcoords[i]);
+    }
+
+    if (geometryDefinition.hasNormals()) {
+        writeArray(srw, path, FabricTokens::primvars_normals, staging.normals);
+    }
+
+    if (geometryDefinition.hasVertexColors()) {
+        writeArray(srw, path, FabricTokens::primvars_COLOR_0, staging.vertexColors);
+    }
+
+    if (geometryDefinition.hasVertexIds()) {
+        writeArray(srw, path, FabricTokens::primvars_vertexId, staging.vertexIds);
+    }
+
+    uint64_t customVertexAttributeIndex = 0;
+    for (const auto& customVertexAttribute : geometryDefinition.getCustomVertexAttributes()) {
+        CALL_TEMPLATED_FUNCTION_WITH_RUNTIME_DATA_TYPE(
+            writeVertexAttributeValues,
+            customVertexAttribute.type,
+            srw,
+            path,
+            customVertexAttribute,
+            staging.customVertexAttributes[customVertexAttributeIndex++]);
+    }
+
+    // clang-format off
+    auto doubleSidedFabric = srw.getAttributeWr<bool>(path, FabricTokens::doubleSided);
+    auto extentFabric = srw.getAttributeWr<pxr::GfRange3d>(path, FabricTokens::extent);
+    auto worldExtentFabric = srw.getAttributeWr<pxr::GfRange3d>(path, FabricTokens::_worldExtent);
+    auto localToEcefTransformFabric = srw.getAttributeWr<pxr::GfMatrix4d>(path, FabricTokens::_cesium_localToEcefTransform);
+    auto worldPositionFabric = srw.getAttributeWr<pxr::GfVec3d>(path, FabricTokens::_worldPosition);
+    auto worldOrientationFabric = srw.getAttributeWr<pxr::GfQuatf>(path, FabricTokens::_worldOrientation);
+    auto worldScaleFabric = srw.getAttributeWr<pxr::GfVec3f>(path, FabricTokens::_worldScale);
+    auto tilesetIdFabric = srw.getAttributeWr<int64_t>(path, FabricTokens::_cesium_tilesetId);
+    // clang-format on
+
+    *doubleSidedFabric = staging.doubleSided;
+    *extentFabric = staging.extent;
+    *worldExtentFabric = staging.worldExtent;
+    *localToEcefTransformFabric = staging.localToEcefTransform;
+    *worldPositionFabric = staging.worldPosition;
+    *worldOrientationFabric = staging.worldOrientation;
+    *worldScaleFabric = staging.worldScale;
+    *tilesetIdFabric = staging.tilesetId;
+}
+
+void writeBucket(
+    omni::fabric::StageReaderWriter& srw,
+    const omni::fabric::PrimBucketList& buckets,
+    size_t bucketId,
+    const FabricGeometryDefinition& geometryDefinition,
+    const BucketStagings& bucketStagings) {
+    const auto texcoordSetCount = geometryDefinition.getTexcoordSetCount();
+
+    if (geometryDefinition.isPoints()) {
+        writeArrays(srw, buckets, bucketId, FabricTokens::widths, bucketStagings, &Staging::widths);
+    } else {
+        writeArrays(srw, buckets, bucketId, FabricTokens::faceVertexCounts, bucketStagings, &Staging::faceVertexCounts);
+        writeArrays(
+            srw, buckets, bucketId, FabricTokens::faceVertexIndices, bucketStagings, &Staging::faceVertexIndices);
+    }
+
+    writeArrays(srw, buckets, bucketId, FabricTokens::points, bucketStagings, &Staging::points);
+
+    for (uint64_t t = 0; t < texcoordSetCount; t++) {
+        auto stFabric = srw.getArrayAttributeArrayWr<glm::fvec2>(buckets, bucketId, FabricTokens::primvars_st_n(t));
+        for (const auto& [i, pStaging] : bucketStagings) {
+            const auto& texcoords = pStaging->texcoords[t];
+            std::copy(texcoords.begin(), texcoords.end(), stFabric[i].begin());
+        }
+    }
+
+    if (geometryDefinition.hasNormals()) {
+        writeArrays(srw, buckets, bucketId, FabricTokens::primvars_normals, bucketStagings, &Staging::normals);
+    }
+
+    if (geometryDefinition.hasVertexColors()) {
+        writeArrays(srw, buckets, bucketId, FabricTokens::primvars_COLOR_0, bucketStagings, &Staging::vertexColors);
+    }
+
+    if (geometryDefinition.hasVertexIds()) {
+        writeArrays(srw, buckets, bucketId, FabricTokens::primvars_vertexId, bucketStagings, &Staging::vertexIds);
+    }
+
+    uint64_t customVertexAttributeIndex = 0;
+    for (const auto& customVertexAttribute : geometryDefinition.getCustomVertexAttributes()) {
+        CALL_TEMPLATED_FUNCTION_WITH_RUNTIME_DATA_TYPE(
+            writeVertexAttributeValueArrays,
+            customVertexAttribute.type,
+            srw,
+            buckets,
+            bucketId,
+            customVertexAttribute,
+            bucketStagings,
+            customVertexAttributeIndex++);
+    }
+
+    // clang-format off
+    auto doubleSidedFabric = srw.getAttributeArrayWr<bool>(buckets, bucketId, FabricTokens::doubleSided);
+    auto extentFabric = srw.getAttributeArrayWr<pxr::GfRange3d>(buckets, bucketId, FabricTokens::extent);
+    auto worldExtentFabric = srw.getAttributeArrayWr<pxr::GfRange3d>(buckets, bucketId, FabricTokens::_worldExtent);
+    auto localToEcefTransformFabric = srw.getAttributeArrayWr<pxr::GfMatrix4d>(buckets, bucketId, FabricTokens::_cesium_localToEcefTransform);
+    auto worldPositionFabric = srw.getAttributeArrayWr<pxr::GfVec3d>(buckets, bucketId, FabricTokens::_worldPosition);
+    auto worldOrientationFabric = srw.getAttributeArrayWr<pxr::GfQuatf>(buckets, bucketId, FabricTokens::_worldOrientation);
+    auto worldScaleFabric = srw.getAttributeArrayWr<pxr::GfVec3f>(buckets, bucketId, FabricTokens::_worldScale);
+    auto tilesetIdFabric = srw.getAttributeArrayWr<int64_t>(buckets, bucketId, FabricTokens::_cesium_tilesetId);
+    // clang-format on
+
+    for (const auto& [i, pStaging] : bucketStagings) {
+        doubleSidedFabric[i] = pStaging->doubleSided;
+        extentFabric[i] = pStaging->extent;
+        worldExtentFabric[i] = pStaging->worldExtent;
+        localToEcefTransformFabric[i] = pStaging->localToEcefTransform;
+        worldPositionFabric[i] = pStaging->worldPosition;
+        worldOrientationFabric[i] = pStaging->worldOrientation;
+        worldScaleFabric[i] = pStaging->worldScale;
+        tilesetIdFabric[i] = pStaging->tilesetId;
+    }
+}
+
+template <typename T>
+std::vector<T> takeEveryNth(const std::vector<T>& values, uint64_t elementSize, uint64_t stride) {
+    const auto elementCount = values.size() / elementSize;
+    std::vector<T> result;
+    result.reserve((elementCount + stride - 1) / stride * elementSize);
+
+    for (uint64_t i = 0; i < elementCount; i += stride) {
+        const auto begin = values.begin() + static_cast<std::ptrdiff_t>(i * elementSize);
+        result.insert(result.end(), begin, begin + static_cast<std::ptrdiff_t>(elementSize));
+    }
+
+    return result;
+}
+
+// Only called with strides greater than one. At a stride of one the points are used as they are rather than copied.
+Staging decimatePoints(const Staging& staging, uint64_t stride) {
+    const auto pointCount = staging.points.size();
+
+    Staging decimated;
+    decimated.points = takeEveryNth(staging.points, 1, stride);
+    decimated.widths = takeEveryNth(staging.widths, 1, stride);
+    decimated.normals = takeEveryNth(staging.normals, 1, stride);
+    decimated.vertexColors = takeEveryNth(staging.vertexColors, 1, stride);
+    decimated.vertexIds = takeEveryNth(staging.vertexIds, 1, stride);
+
+    for (const auto& texcoords : staging.texcoords) {
+        decimated.texcoords.push_back(takeEveryNth(texcoords, 1, stride));
+    }
+
+    // Custom vertex attributes are raw bytes, so each point's value spans several elements
+    for (const auto& values : staging.customVertexAttributes) {
+        const auto elementSize = pointCount == 0 ? 1 : std::max(values.size() / pointCount, size_t{1});
+        decimated.customVertexAttributes.push_back(takeEveryNth(values, elementSize, stride));
+    }
+
+    // The kept points are a subset of the original points so the extent still bounds them
+    decimated.doubleSided = staging.doubleSided;
+    decimated.extent = staging.extent;
+    decimated.worldExtent = staging.worldExtent;
+    decimated.localToEcefTransform = staging.localToEcefTransform;
+    decimated.worldPosition = staging.worldPosition;
+    decimated.worldOrientation = staging.worldOrientation;
+    decimated.worldScale = staging.worldScale;
+    decimated.tilesetId = staging.tilesetId;
+
+    return decimated;
+}
+
+template <typename T>
+void remapVertices(std::vector<T>& values, const std::vector<uint32_t>& remap, size_t remappedVertexCount) {
+    // Texcoord sets that aren't mapped are empty. Custom vertex attributes are raw bytes, several per vertex.
+    if (values.empty() || values.size() % remap.size() != 0) {
+        return;
+    }
+
+    const auto elementSize = values.size() / remap.size();
+    std::vector<T> remapped(remappedVertexCount * elementSize);
+    meshopt_remapVertexBuffer(remapped.data(), values.data(), remap.size(), sizeof(T) * elementSize, remap.data());
+    values = std::move(remapped);
+}
+
+void optimizeMesh(Staging& staging) {
+    CESIUM_TRACE("FabricGeometry::optimizeMesh");
+
+    auto& faceVertexIndices = staging.faceVertexIndices;
+    const auto indexCount = faceVertexIndices.size();
+    const auto vertexCount = staging.points.size();
+
+    if (indexCount == 0 || indexCount % 3 != 0) {
+        return;
+    }
+
+    std::vector<uint32_t> indices;
+    indices.reserve(indexCount);
+
+    for (const auto index : faceVertexIndices) {
+        if (index < 0 || static_cast<size_t>(index) >= vertexCount) {
+            return;
+        }
+
+        indices.push_back(static_cast<uint32_t>(index));
+    }
+
+    meshopt_optimizeVertexCache(indices.data(), indices.data(), indexCount, vertexCount);
+    meshopt_optimizeOverdraw(
+        indices.data(),
+        indices.data(),
+        indexCount,
+        &staging.points[0].x,
+        vertexCount,
+        sizeof(glm::fvec3),
+        OVERDRAW_THRESHOLD);
+
+    // Vertices are renumbered in the order they are first used. Vertices that no triangle uses are dropped.
+    std::vector<uint32_t> remap(vertexCount);
+    const auto remappedVertexCount =
+        meshopt_optimizeVertexFetchRemap(remap.data(), indices.data(), indexCount, vertexCount);
+    meshopt_remapIndexBuffer(indices.data(), indices.data(), indexCount, remap.data());
+
+    std::transform(indices.begin(), indices.end(), faceVertexIndices.begin(), [](uint32_t index) {
+        return static_cast<int>(index);
+    });
+
+    // Every per-vertex array moves together so that each index still refers to the same vertex
+    remapVertices(staging.points, remap, remappedVertexCount);
+    remapVertices(staging.normals, remap, remappedVertexCount);
+    remapVertices(staging.vertexColors, remap, remappedVertexCount);
+    remapVertices(staging.vertexIds, remap, remappedVertexCount);
+
+    for (auto& texcoords : staging.texcoords) {
+        remapVertices(texcoords, remap, remappedVertexCount);
+    }
+
+    for (auto& values : staging.customVertexAttributes) {
+        remapVertices(values, remap, remappedVertexCount);
+    }
 }
 
 } // namespace
@@ -117,6 +499,7 @@ void FabricGeometry::setMaterial(const omni::fabric::Path& materialPath) {
 }
 
 void FabricGeometry::initialize() {
+    const auto isPoints = _geometryDefinition.isPoints();
     const auto hasNormals = _geometryDefinition.hasNormals();
     const auto hasVertexColors = _geometryDefinition.hasVertexColors();
     const auto texcoordSetCount = _geometryDefinition.getTexcoordSetCount();
@@ -129,22 +512,29 @@ void FabricGeometry::initialize() {
     srw.createPrim(_path);
 
     FabricAttributesBuilder attributes;
-    attributes.addAttribute(FabricTypes::faceVertexCounts, FabricTokens::faceVertexCounts);
-    attributes.addAttribute(FabricTypes::faceVertexIndices, FabricTokens::faceVertexIndices);
+
+    if (isPoints) {
+        attributes.addAttribute(FabricTypes::Points, FabricTokens::Points);
+        attributes.addAttribute(FabricTypes::widths, FabricTokens::widths);
+    } else {
+        attributes.addAttribute(FabricTypes::Mesh, FabricTokens::Mesh);
+        attributes.addAttribute(FabricTypes::faceVertexCounts, FabricTokens::faceVertexCounts);
+        attributes.addAttribute(FabricTypes::faceVertexIndices, FabricTokens::faceVertexIndices);
+        attributes.addAttribute(FabricTypes::subdivisionScheme, FabricTokens::subdivisionScheme);
+    }
+
     attributes.addAttribute(FabricTypes::points, FabricTokens::points);
     attributes.addAttribute(FabricTypes::extent, FabricTokens::extent);
     attributes.addAttribute(FabricTypes::_worldExtent, FabricTokens::_worldExtent);
     attributes.addAttribute(FabricTypes::_worldVisibility, FabricTokens::_worldVisibility);
     attributes.addAttribute(FabricTypes::primvars, FabricTokens::primvars);
     attributes.addAttribute(FabricTypes::primvarInterpolations, FabricTokens::primvarInterpolations);
-    attributes.addAttribute(FabricTypes::Mesh, FabricTokens::Mesh);
     attributes.addAttribute(FabricTypes::_cesium_tilesetId, FabricTokens::_cesium_tilesetId);
     attributes.addAttribute(FabricTypes::_cesium_localToEcefTransform, FabricTokens::_cesium_localToEcefTransform);
     attributes.addAttribute(FabricTypes::_worldPosition, FabricTokens::_worldPosition);
     attributes.addAttribute(FabricTypes::_worldOrientation, FabricTokens::_worldOrientation);
     attributes.addAttribute(FabricTypes::_worldScale, FabricTokens::_worldScale);
     attributes.addAttribute(FabricTypes::doubleSided, FabricTokens::doubleSided);
-    attributes.addAttribute(FabricTypes::subdivisionScheme, FabricTokens::subdivisionScheme);
     attributes.addAttribute(FabricTypes::material_binding, FabricTokens::material_binding);
 
     for (uint64_t i = 0; i < texcoordSetCount; i++) {
@@ -170,8 +560,11 @@ void FabricGeometry::initialize() {
 
     attributes.createAttributes(_path);
 
-    auto subdivisionSchemeFabric = srw.getAttributeWr<omni::fabric::TokenC>(_path, FabricTokens::subdivisionScheme);
-    *subdivisionSchemeFabric = FabricTokens::none;
+    if (!isPoints) {
+        auto subdivisionSchemeFabric =
+            srw.getAttributeWr<omni::fabric::TokenC>(_path, FabricTokens::subdivisionScheme);
+        *subdivisionSchemeFabric = FabricTokens::none;
+    }
 
     // Initialize primvars
     size_t primvarsCount = 0;
@@ -241,6 +634,12 @@ void FabricGeometry::initialize() {
 }
 
 void FabricGeometry::reset() {
+    // Drop geometry that was staged for the previous tile but never written
+    _staging.reset();
+    _points.reset();
+    _stagePoints = false;
+
+    const auto isPoints = _geometryDefinition.isPoints();
     const auto hasNormals = _geometryDefinition.hasNormals();
     const auto hasVertexColors = _geometryDefinition.hasVertexColors();
     const auto texcoordSetCount = _geometryDefinition.getTexcoordSetCount();
@@ -272,10 +671,15 @@ void FabricGeometry::reset() {
     FabricUtil::setTilesetId(_path, NO_TILESET_ID);
 
     srw.setArrayAttributeSize(_path, FabricTokens::material_binding, 0);
-    srw.setArrayAttributeSize(_path, FabricTokens::faceVertexCounts, 0);
-    srw.setArrayAttributeSize(_path, FabricTokens::faceVertexIndices, 0);
     srw.setArrayAttributeSize(_path, FabricTokens::points, 0);
 
+    if (isPoints) {
+        srw.setArrayAttributeSize(_path, FabricTokens::widths, 0);
+    } else {
+        srw.setArrayAttributeSize(_path, FabricTokens::faceVertexCounts, 0);
+        srw.setArrayAttributeSize(_path, FabricTokens::faceVertexIndices, 0);
+    }
+
     for (uint64_t i = 0; i < texcoordSetCount; i++) {
         srw.setArrayAttributeSize(_path, FabricTokens::primvars_st_n(i), 0);
     }
@@ -297,7 +701,7 @@ void FabricGeometry::reset() {
     }
 }
 
-void FabricGeometry::setGeometry(
+std::optional<FabricGeometryStaging> FabricGeometry::stageGeometry(
     int64_t tilesetId,
     const glm::dmat4& ecefToUsdTransform,
     const glm::dmat4& gltfToEcefTransform,
@@ -306,224 +710,271 @@ void FabricGeometry::setGeometry(
     const CesiumGltf::MeshPrimitive& primitive,
     const MaterialInfo& materialInfo,
     bool smoothNormals,
-    const std::unordered_map<uint64_t, uint64_t>& texcoordIndexMapping,
-    const std::unordered_map<uint64_t, uint64_t>& imageryTexcoordIndexMapping) {
-
-    if (stageDestroyed()) {
-        return;
-    }
+    bool weldNormals,
+    bool optimizeMeshes,
+    const SmallMap<uint64_t, uint64_t>& texcoordIndexMapping,
+    const SmallMap<uint64_t, uint64_t>& imageryTexcoordIndexMapping) const {
 
+    const auto isPoints = _geometryDefinition.isPoints();
     const auto hasNormals = _geometryDefinition.hasNormals();
     const auto hasVertexColors = _geometryDefinition.hasVertexColors();
     const auto& customVertexAttributes = _geometryDefinition.getCustomVertexAttributes();
     const auto hasVertexIds = _geometryDefinition.hasVertexIds();
 
-    auto srw = UsdUtil::getFabricStageReaderWriter();
+    // Point clouds that aren't drawn as a Points prim fall back to a cube per point
+    const auto isPointCloud = primitive.mode == CesiumGltf::MeshPrimitive::Mode::POINTS;
+    const auto isCubes = isPointCloud && !isPoints;
 
     const auto positions = GltfUtil::getPositions(model, primitive);
     const auto indices = GltfUtil::getIndices(model, primitive, positions);
-    const auto normals = GltfUtil::getNormals(model, primitive, positions, indices, smoothNormals);
+    const auto normals =
+        GltfUtil::getNormals(model, primitive, positions, indices, smoothNormals && !isPointCloud, weldNormals);
     const auto vertexColors = GltfUtil::getVertexColors(model, primitive, 0);
     const auto vertexIds = GltfUtil::getVertexIds(positions);
     const auto extent = GltfUtil::getExtent(model, primitive);
     const auto faceVertexCounts = GltfUtil::getFaceVertexCounts(indices);
 
     if (positions.size() == 0 || indices.size() == 0 || !extent.has_value()) {
-        return;
+        return std::nullopt;
     }
 
-    const auto doubleSided = materialInfo.doubleSided;
+    FabricGeometryStaging staging;
+
     const auto localExtent = UsdUtil::glmToUsdRange(extent.value());
     const auto localToEcefTransform = gltfToEcefTransform * nodeTransform;
     const auto localToUsdTransform = ecefToUsdTransform * localToEcefTransform;
     const auto [worldPosition, worldOrientation, worldScale] = UsdUtil::glmToUsdMatrixDecomposed(localToUsdTransform);
-    const auto worldExtent = UsdUtil::computeWorldExtent(localExtent, localToUsdTransform);
 
-    if (primitive.mode == CesiumGltf::MeshPrimitive::Mode::POINTS) {
-        const auto numVoxels = positions.size();
-        const auto shapeHalfSize = 1.5f;
-        srw.setArrayAttributeSize(_path, FabricTokens::points, numVoxels * 8);
-        srw.setArrayAttributeSize(_path, FabricTokens::faceVertexCounts, numVoxels * 2 * 6);
-        srw.setArrayAttributeSize(_path, FabricTokens::faceVertexIndices, numVoxels * 6 * 2 * 3);
-
-        auto pointsFabric = srw.getArrayAttributeWr<glm::fvec3>(_path, FabricTokens::points);
-        auto faceVertexCountsFabric = srw.getArrayAttributeWr<int>(_path, FabricTokens::faceVertexCounts);
-        auto faceVertexIndicesFabric = srw.getArrayAttributeWr<int>(_path, FabricTokens::faceVertexIndices);
-
-        if (hasVertexColors) {
-            srw.setArrayAttributeSize(_path, FabricTokens::primvars_COLOR_0, numVoxels * 8);
-            auto vertexColorsFabric = srw.getArrayAttributeWr<glm::fvec4>(_path, FabricTokens::primvars_COLOR_0);
-            vertexColors.fill(vertexColorsFabric, 8);
-        }
+    staging.doubleSided = materialInfo.doubleSided;
+    staging.extent = localExtent;
+    staging.worldExtent = UsdUtil::computeWorldExtent(localExtent, localToUsdTransform);
+    staging.localToEcefTransform = UsdUtil::glmToUsdMatrix(localToEcefTransform);
+    staging.worldPosition = worldPosition;
+    staging.worldOrientation = worldOrientation;
+    staging.worldScale = worldScale;
+    staging.tilesetId = tilesetId;
 
-        if (hasVertexIds) {
-            srw.setArrayAttributeSize(_path, FabricTokens::primvars_vertexId, numVoxels * 8);
-            auto vertexIdsFabric = srw.getArrayAttributeWr<float>(_path, FabricTokens::primvars_vertexId);
-            vertexIds.fill(vertexIdsFabric, 8);
-        }
+    // Texcoord sets that aren't mapped stay empty
+    staging.texcoords.resize(_geometryDefinition.getTexcoordSetCount());
 
-        for (const auto& customVertexAttribute : customVertexAttributes) {
-            CALL_TEMPLATED_FUNCTION_WITH_RUNTIME_DATA_TYPE(
-                setVertexAttributeValues,
-                customVertexAttribute.type,
-                srw,
-                _path,
-                model,
-                primitive,
-                customVertexAttribute,
-                8);
-        }
+    // Each cube has eight corners, so per-vertex values are repeated eight times
+    const auto repeat = isCubes ? uint64_t(8) : uint64_t(1);
+
+    if (isCubes) {
+        const auto numVoxels = positions.size();
+        const auto shapeHalfSize = CUBE_HALF_SIZE;
+        staging.points.resize(numVoxels * 8);
+        staging.faceVertexCounts.resize(numVoxels * 2 * 6, 3);
+        staging.faceVertexIndices.resize(numVoxels * 6 * 2 * 3);
+
+        // Two triangles for each face: front, left, right, top, bottom, back
+        const std::array<int, 36> cubeIndices{{
+            0, 1, 2, 0, 2, 3, 4, 5, 1, 4, 1, 0, 3, 2, 6, 3, 6, 7,
+            1, 5, 6, 1, 5, 2, 3, 7, 4, 3, 4, 0, 7, 6, 5, 7, 5, 4,
+        }};
 
         size_t vertIndex = 0;
-        size_t vertexCountsIndex = 0;
         size_t faceVertexIndex = 0;
         for (size_t voxelIndex = 0; voxelIndex < numVoxels; voxelIndex++) {
             const auto& center = positions.get(voxelIndex);
 
-            pointsFabric[vertIndex++] = glm::fvec3{-shapeHalfSize, -shapeHalfSize, -shapeHalfSize} + center;
-            pointsFabric[vertIndex++] = glm::fvec3{-shapeHalfSize, shapeHalfSize, -shapeHalfSize} + center;
-            pointsFabric[vertIndex++] = glm::fvec3{shapeHalfSize, shapeHalfSize, -shapeHalfSize} + center;
-            pointsFabric[vertIndex++] = glm::fvec3{shapeHalfSize, -shapeHalfSize, -shapeHalfSize} + center;
-            pointsFabric[vertIndex++] = glm::fvec3{-shapeHalfSize, -shapeHalfSize, shapeHalfSize} + center;
-            pointsFabric[vertIndex++] = glm::fvec3{-shapeHalfSize, shapeHalfSize, shapeHalfSize} + center;
-            pointsFabric[vertIndex++] = glm::fvec3{shapeHalfSize, shapeHalfSize, shapeHalfSize} + center;
-            pointsFabric[vertIndex++] = glm::fvec3{shapeHalfSize, -shapeHalfSize, shapeHalfSize} + center;
-
-            for (int i = 0; i < 6; i++) {
-                faceVertexCountsFabric[vertexCountsIndex++] = 3;
-                faceVertexCountsFabric[vertexCountsIndex++] = 3;
+            staging.points[vertIndex++] = glm::fvec3{-shapeHalfSize, -shapeHalfSize, -shapeHalfSize} + center;
+            staging.points[vertIndex++] = glm::fvec3{-shapeHalfSize, shapeHalfSize, -shapeHalfSize} + center;
+            staging.points[vertIndex++] = glm::fvec3{shapeHalfSize, shapeHalfSize, -shapeHalfSize} + center;
+            staging.points[vertIndex++] = glm::fvec3{shapeHalfSize, -shapeHalfSize, -shapeHalfSize} + center;
+            staging.points[vertIndex++] = glm::fvec3{-shapeHalfSize, -shapeHalfSize, shapeHalfSize} + center;
+            staging.points[vertIndex++] = glm::fvec3{-shapeHalfSize, shapeHalfSize, shapeHalfSize} + center;
+            staging.points[vertIndex++] = glm::fvec3{shapeHalfSize, shapeHalfSize, shapeHalfSize} + center;
+            staging.points[vertIndex++] = glm::fvec3{shapeHalfSize, -shapeHalfSize, shapeHalfSize} + center;
+
+            for (const auto cubeIndex : cubeIndices) {
+                staging.faceVertexIndices[faceVertexIndex++] = cubeIndex + static_cast<int>(voxelIndex * 8);
             }
-
-            // front
-            faceVertexIndicesFabric[faceVertexIndex++] = 0 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 1 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 2 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 0 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 2 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 3 + static_cast<int>(voxelIndex * 8);
-            // left
-            faceVertexIndicesFabric[faceVertexIndex++] = 4 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 5 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 1 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 4 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 1 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 0 + static_cast<int>(voxelIndex * 8);
-            // right
-            faceVertexIndicesFabric[faceVertexIndex++] = 3 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 2 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 6 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 3 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 6 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 7 + static_cast<int>(voxelIndex * 8);
-            // top
-            faceVertexIndicesFabric[faceVertexIndex++] = 1 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 5 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 6 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 1 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 5 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 2 + static_cast<int>(voxelIndex * 8);
-            // bottom
-            faceVertexIndicesFabric[faceVertexIndex++] = 3 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 7 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 4 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 3 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 4 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 0 + static_cast<int>(voxelIndex * 8);
-            // back
-            faceVertexIndicesFabric[faceVertexIndex++] = 7 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 6 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 5 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 7 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 5 + static_cast<int>(voxelIndex * 8);
-            faceVertexIndicesFabric[faceVertexIndex++] = 4 + static_cast<int>(voxelIndex * 8);
         }
     } else {
-        srw.setArrayAttributeSize(_path, FabricTokens::faceVertexCounts, faceVertexCounts.size());
-        srw.setArrayAttributeSize(_path, FabricTokens::faceVertexIndices, indices.size());
-        srw.setArrayAttributeSize(_path, FabricTokens::points, positions.size());
-
-        auto faceVertexCountsFabric = srw.getArrayAttributeWr<int>(_path, FabricTokens::faceVertexCounts);
-        auto faceVertexIndicesFabric = srw.getArrayAttributeWr<int>(_path, FabricTokens::faceVertexIndices);
-        auto pointsFabric = srw.getArrayAttributeWr<glm::fvec3>(_path, FabricTokens::points);
-
-        faceVertexCounts.fill(faceVertexCountsFabric);
-        indices.fill(faceVertexIndicesFabric);
-        positions.fill(pointsFabric);
-
-        const auto fillTexcoords = [this, &srw](uint64_t texcoordIndex, const TexcoordsAccessor& texcoords) {
-            assert(texcoordIndex < _geometryDefinition.getTexcoordSetCount());
-            const auto& primvarStToken = FabricTokens::primvars_st_n(texcoordIndex);
-            srw.setArrayAttributeSize(_path, primvarStToken, texcoords.size());
-            auto stFabric = srw.getArrayAttributeWr<glm::fvec2>(_path, primvarStToken);
-            texcoords.fill(stFabric);
+        if (isPoints) {
+            staging.widths.assign(positions.size(), POINT_WIDTH);
+        } else {
+            staging.faceVertexCounts.resize(faceVertexCounts.size());
+            staging.faceVertexIndices.resize(indices.size());
+
+            faceVertexCounts.fill(staging.faceVertexCounts);
+            indices.fill(staging.faceVertexIndices);
+        }
+
+        staging.points.resize(positions.size());
+        positions.fill(staging.points);
+
+        const auto stageTexcoords = [&staging](uint64_t texcoordIndex, const TexcoordsAccessor& texcoords) {
+            assert(texcoordIndex < staging.texcoords.size());
+            auto& stagedTexcoords = staging.texcoords[texcoordIndex];
+            stagedTexcoords.resize(texcoords.size());
+            texcoords.fill(stagedTexcoords);
         };
 
         for (const auto& [gltfSetIndex, primvarStIndex] : texcoordIndexMapping) {
-            const auto texcoords = GltfUtil::getTexcoords(model, primitive, gltfSetIndex);
-            fillTexcoords(primvarStIndex, texcoords);
+            stageTexcoords(primvarStIndex, GltfUtil::getTexcoords(model, primitive, gltfSetIndex));
         }
 
         for (const auto& [gltfSetIndex, primvarStIndex] : imageryTexcoordIndexMapping) {
-            const auto texcoords = GltfUtil::getImageryTexcoords(model, primitive, gltfSetIndex);
-            fillTexcoords(primvarStIndex, texcoords);
+            stageTexcoords(primvarStIndex, GltfUtil::getImageryTexcoords(model, primitive, gltfSetIndex));
         }
 
         if (hasNormals) {
-            srw.setArrayAttributeSize(_path, FabricTokens::primvars_normals, normals.size());
+            staging.normals.resize(normals.size());
+            normals.fill(staging.normals);
+        }
+    }
+
+    if (hasVertexColors) {
+        staging.vertexColors.resize(vertexColors.size() * repeat);
+        vertexColors.fill(staging.vertexColors, repeat);
+    }
+
+    if (hasVertexIds) {
+        staging.vertexIds.resize(vertexIds.size() * repeat);
+        vertexIds.fill(staging.vertexIds, repeat);
+    }
+
+    staging.customVertexAttributes.reserve(customVertexAttributes.size());
+    for (const auto& customVertexAttribute : customVertexAttributes) {
+        auto& values = staging.customVertexAttributes.emplace_back();
+        CALL_TEMPLATED_FUNCTION_WITH_RUNTIME_DATA_TYPE(
+            stageVertexAttributeValues,
+            customVertexAttribute.type,
+            model,
+            primitive,
+            customVertexAttribute,
+            repeat,
+            values);
+    }
+
+    // Indices are reordered after every attribute is staged so that all of them can be remapped together
+    if (optimizeMeshes && !isPointCloud) {
+        optimizeMesh(staging);
+    }
+
+    return staging;
+}
+
+void FabricGeometry::setGeometry(FabricGeometryStaging&& staging) {
+    if (stageDestroyed()) {
+        return;
+    }
+
+    _staging = std::move(staging);
+}
+
+void FabricGeometry::setPoints(FabricGeometryStaging&& staging, uint64_t retainedStride) {
+    if (stageDestroyed()) {
+        return;
+    }
+
+    if (retainedStride > 1) {
+        _points = decimatePoints(staging, retainedStride);
+    } else {
+        _points = std::move(staging);
+    }
+}
+
+void FabricGeometry::setPointStride(uint64_t stride) {
+    if (!_points.has_value() || stageDestroyed()) {
+        return;
+    }
+
+    // At a stride of one every retained point is written straight from _points
+    if (stride > 1) {
+        _staging = decimatePoints(_points.value(), stride);
+        _stagePoints = false;
+    } else {
+        _staging.reset();
+        _stagePoints = true;
+    }
+}
+
+void FabricGeometry::writeGeometries(const std::vector<std::shared_ptr<FabricGeometry>>& geometries) {
+    CESIUM_TRACE("FabricGeometry::writeGeometries");
 
-            auto normalsFabric = srw.getArrayAttributeWr<glm::fvec3>(_path, FabricTokens::primvars_normals);
+    std::unordered_map<uint64_t, FabricGeometry*> pending;
+    pending.reserve(geometries.size());
 
-            normals.fill(normalsFabric);
+    for (const auto& pGeometry : geometries) {
+        if (pGeometry->getStaging() != nullptr && !pGeometry->stageDestroyed()) {
+            pending.emplace(omni::fabric::PathC(pGeometry->_path).path, pGeometry.get());
         }
+    }
 
-        if (hasVertexColors) {
-            srw.setArrayAttributeSize(_path, FabricTokens::primvars_COLOR_0, vertexColors.size());
+    if (pending.empty()) {
+        return;
+    }
 
-            auto vertexColorsFabric = srw.getArrayAttributeWr<glm::fvec4>(_path, FabricTokens::primvars_COLOR_0);
+    auto srw = UsdUtil::getFabricStageReaderWriter();
 
-            vertexColors.fill(vertexColorsFabric);
+    if (pending.size() < MIN_BATCH_SIZE) {
+        for (const auto& [pathId, pGeometry] : pending) {
+            writeGeometry(srw, pGeometry->_path, pGeometry->_geometryDefinition, *pGeometry->getStaging());
+            pGeometry->clearStaging();
         }
 
-        if (hasVertexIds) {
-            srw.setArrayAttributeSize(_path, FabricTokens::primvars_vertexId, vertexIds.size());
+        return;
+    }
+
+    // Resizing an array can move the bucket's storage, so every array is resized before any pointers are fetched
+    for (const auto& [pathId, pGeometry] : pending) {
+        resizeArrays(srw, pGeometry->_path, pGeometry->_geometryDefinition, *pGeometry->getStaging());
+    }
+
+    // Tagging the pending prims would narrow the query but moves each prim to another bucket and back, so instead
+    // the geometry buckets are queried as they are and their rows are filtered against the pending map
+    const auto buckets = srw.findPrims(
+        {omni::fabric::AttrNameAndType(FabricTypes::_cesium_tilesetId, FabricTokens::_cesium_tilesetId)},
+        {omni::fabric::AttrNameAndType(FabricTypes::Mesh, FabricTokens::Mesh),
+         omni::fabric::AttrNameAndType(FabricTypes::Points, FabricTokens::Points)});
+
+    BucketStagings bucketStagings;
+    uint64_t writtenCount = 0;
+
+    for (size_t bucketId = 0; bucketId < buckets.bucketCount() && writtenCount < pending.size(); bucketId++) {
+        const auto paths = srw.getPathArray(buckets, bucketId);
 
-            auto vertexIdsFabric = srw.getArrayAttributeWr<float>(_path, FabricTokens::primvars_vertexId);
+        const FabricGeometryDefinition* pGeometryDefinition = nullptr;
+        bucketStagings.clear();
 
-            vertexIds.fill(vertexIdsFabric);
+        for (size_t i = 0; i < paths.size(); i++) {
+            const auto iter = pending.find(omni::fabric::PathC(paths[i]).path);
+            if (iter != pending.end()) {
+                // Prims in the same bucket have the same attributes and therefore the same geometry definition
+                pGeometryDefinition = &iter->second->_geometryDefinition;
+                bucketStagings.emplace_back(i, iter->second->getStaging());
+            }
         }
 
-        for (const auto& customVertexAttribute : customVertexAttributes) {
-            CALL_TEMPLATED_FUNCTION_WITH_RUNTIME_DATA_TYPE(
-                setVertexAttributeValues,
-                customVertexAttribute.type,
-                srw,
-                _path,
-                model,
-                primitive,
-                customVertexAttribute,
-                1);
+        if (pGeometryDefinition) {
+            writeBucket(srw, buckets, bucketId, *pGeometryDefinition, bucketStagings);
+            writtenCount += bucketStagings.size();
         }
     }
 
-    // clang-format off
-    auto doubleSidedFabric = srw.getAttributeWr<bool>(_path, FabricTokens::doubleSided);
-    auto extentFabric = srw.getAttributeWr<pxr::GfRange3d>(_path, FabricTokens::extent);
-    auto worldExtentFabric = srw.getAttributeWr<pxr::GfRange3d>(_path, FabricTokens::_worldExtent);
-    auto localToEcefTransformFabric = srw.getAttributeWr<pxr::GfMatrix4d>(_path, FabricTokens::_cesium_localToEcefTransform);
-    auto worldPositionFabric = srw.getAttributeWr<pxr::GfVec3d>(_path, FabricTokens::_worldPosition);
-    auto worldOrientationFabric = srw.getAttributeWr<pxr::GfQuatf>(_path, FabricTokens::_worldOrientation);
-    auto worldScaleFabric = srw.getAttributeWr<pxr::GfVec3f>(_path, FabricTokens::_worldScale);
-    // clang-format on
+    for (const auto& [pathId, pGeometry] : pending) {
+        pGeometry->clearStaging();
+    }
+}
+
+const FabricGeometryStaging* FabricGeometry::getStaging() const {
+    if (_staging.has_value()) {
+        return &_staging.value();
+    }
 
-    *doubleSidedFabric = doubleSided;
-    *extentFabric = localExtent;
-    *worldExtentFabric = worldExtent;
-    *localToEcefTransformFabric = UsdUtil::glmToUsdMatrix(localToEcefTransform);
-    *worldPositionFabric = worldPosition;
-    *worldOrientationFabric = worldOrientation;
-    *worldScaleFabric = worldScale;
+    if (_stagePoints && _points.has_value()) {
+        return &_points.value();
+    }
+
+    return nullptr;
+}
 
-    FabricUtil::setTilesetId(_path, tilesetId);
+void FabricGeometry::clearStaging() {
+    _staging.reset();
+    _stagePoints = false;
 }
 
 bool FabricGeometry::stageDestroyed() {
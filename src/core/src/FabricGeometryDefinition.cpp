@@ -1,28 +1,21 @@
 #include "cesium/omniverse/FabricGeometryDefinition.h"
 
-#include "cesium/omniverse/GltfUtil.h"
-
-#ifdef CESIUM_OMNI_MSVC
-#pragma push_macro("OPAQUE")
-#undef OPAQUE
-#endif
-
-#include <CesiumGltf/Model.h>
+#include "cesium/omniverse/PrimitiveDescriptor.h"
 
 namespace cesium::omniverse {
 
-FabricGeometryDefinition::FabricGeometryDefinition(
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive,
-    const FeaturesInfo& featuresInfo,
-    bool smoothNormals)
-    : _hasNormals(GltfUtil::hasNormals(model, primitive, smoothNormals))
-    , _hasVertexColors(GltfUtil::hasVertexColors(model, primitive, 0))
-    , _hasVertexIds(hasFeatureIdType(featuresInfo, FeatureIdType::INDEX))
+FabricGeometryDefinition::FabricGeometryDefinition(const PrimitiveDescriptor& primitiveDescriptor)
+    : _isPoints(primitiveDescriptor.isPoints)
+    , _hasNormals(primitiveDescriptor.hasNormals)
+    , _hasVertexColors(primitiveDescriptor.hasVertexColors)
+    , _hasVertexIds(hasFeatureIdType(primitiveDescriptor.featuresInfo, FeatureIdType::INDEX))
     , _texcoordSetCount(
-          GltfUtil::getTexcoordSetIndexes(model, primitive).size() +
-          GltfUtil::getImageryTexcoordSetIndexes(model, primitive).size())
-    , _customVertexAttributes(GltfUtil::getCustomVertexAttributes(model, primitive)) {}
+          primitiveDescriptor.texcoordSetIndexes.size() + primitiveDescriptor.imageryTexcoordSetIndexes.size())
+    , _customVertexAttributes(primitiveDescriptor.customVertexAttributes) {}
+
+bool FabricGeometryDefinition::isPoints() const {
+    return _isPoints;
+}
 
 bool FabricGeometryDefinition::hasNormals() const {
     return _hasNormals;
@@ -45,8 +38,9 @@ const std::set<VertexAttributeInfo>& FabricGeometryDefinition::getCustomVertexAt
 }
 
 bool FabricGeometryDefinition::operator==(const FabricGeometryDefinition& other) const {
-    return _hasNormals == other._hasNormals && _hasVertexColors == other._hasVertexColors &&
-           _hasVertexIds == other._hasVertexIds && _texcoordSetCount == other._texcoordSetCount &&
+    return _isPoints == other._isPoints && _hasNormals == other._hasNormals &&
+           _hasVertexColors == other._hasVertexColors && _hasVertexIds == other._hasVertexIds &&
+           _texcoordSetCount == other._texcoordSetCount &&
            _customVertexAttributes == other._customVertexAttributes;
 }
 
@@ -1326,11 +1326,11 @@ void FabricMaterial::setMaterial(
     const std::vector<std::shared_ptr<FabricTexture>>& propertyTableTextures,
     const glm::dvec3& displayColor,
     double displayOpacity,
-    const std::unordered_map<uint64_t, uint64_t>& texcoordIndexMapping,
+    const SmallMap<uint64_t, uint64_t>& texcoordIndexMapping,
     const std::vector<uint64_t>& featureIdIndexSetIndexMapping,
     const std::vector<uint64_t>& featureIdAttributeSetIndexMapping,
     const std::vector<uint64_t>& featureIdTextureSetIndexMapping,
-    const std::unordered_map<uint64_t, uint64_t>& propertyTextureIndexMapping) {
+    const SmallMap<uint64_t, uint64_t>& propertyTextureIndexMapping) {
 
     if (stageDestroyed()) {
         return;
@@ -1602,7 +1602,7 @@ void FabricMaterial::setImageryLayer(
     const TextureInfo& textureInfo,
     uint64_t imageryLayerIndex,
     double alpha,
-    const std::unordered_map<uint64_t, uint64_t>& imageryTexcoordIndexMapping) {
+    const SmallMap<uint64_t, uint64_t>& imageryTexcoordIndexMapping) {
     if (stageDestroyed()) {
         return;
     }
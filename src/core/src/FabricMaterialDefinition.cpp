@@ -2,13 +2,7 @@
 
 #include "cesium/omniverse/GltfUtil.h"
 #include "cesium/omniverse/MetadataUtil.h"
-
-#ifdef CESIUM_OMNI_MSVC
-#pragma push_macro("OPAQUE")
-#undef OPAQUE
-#endif
-
-#include <CesiumGltf/Model.h>
+#include "cesium/omniverse/PrimitiveDescriptor.h"
 
 namespace cesium::omniverse {
 
@@ -25,8 +19,7 @@ std::vector<FeatureIdType> filterFeatureIdTypes(const FeaturesInfo& featuresInfo
 }
 
 std::vector<MetadataUtil::PropertyDefinition> getStyleableProperties(
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive,
+    const PrimitiveDescriptor& primitiveDescriptor,
     const pxr::SdfPath& tilesetMaterialPath) {
 
     if (tilesetMaterialPath.IsEmpty()) {
@@ -34,24 +27,21 @@ std::vector<MetadataUtil::PropertyDefinition> getStyleableProperties(
         return {};
     }
 
-    return MetadataUtil::getStyleableProperties(model, primitive);
+    return primitiveDescriptor.styleableProperties;
 }
 } // namespace
 
 FabricMaterialDefinition::FabricMaterialDefinition(
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive,
-    const MaterialInfo& materialInfo,
-    const FeaturesInfo& featuresInfo,
+    const PrimitiveDescriptor& primitiveDescriptor,
     uint64_t imageryLayerCount,
     bool disableTextures,
     const pxr::SdfPath& tilesetMaterialPath)
-    : _hasVertexColors(materialInfo.hasVertexColors)
-    , _hasBaseColorTexture(disableTextures ? false : materialInfo.baseColorTexture.has_value())
-    , _featureIdTypes(filterFeatureIdTypes(featuresInfo, disableTextures))
+    : _hasVertexColors(primitiveDescriptor.materialInfo.hasVertexColors)
+    , _hasBaseColorTexture(disableTextures ? false : primitiveDescriptor.materialInfo.baseColorTexture.has_value())
+    , _featureIdTypes(filterFeatureIdTypes(primitiveDescriptor.featuresInfo, disableTextures))
     , _imageryLayerCount(disableTextures ? 0 : imageryLayerCount)
     , _tilesetMaterialPath(tilesetMaterialPath)
-    , _properties(getStyleableProperties(model, primitive, tilesetMaterialPath)) {}
+    , _properties(getStyleableProperties(primitiveDescriptor, tilesetMaterialPath)) {}
 
 bool FabricMaterialDefinition::hasVertexColors() const {
     return _hasVertexColors;
@@ -6,10 +6,13 @@
 #include "cesium/omniverse/FabricResourceManager.h"
 #include "cesium/omniverse/FabricTexture.h"
 #include "cesium/omniverse/FabricUtil.h"
-#include "cesium/omniverse/GeospatialUtil.h"
 #include "cesium/omniverse/GltfUtil.h"
+#include "cesium/omniverse/HttpAssetAccessor.h"
 #include "cesium/omniverse/MetadataUtil.h"
 #include "cesium/omniverse/OmniTileset.h"
+#include "cesium/omniverse/PrimitiveDescriptor.h"
+#include "cesium/omniverse/SlabAllocator.h"
+#include "cesium/omniverse/UriUtil.h"
 #include "cesium/omniverse/UsdUtil.h"
 
 #ifdef CESIUM_OMNI_MSVC
@@ -24,10 +27,19 @@
 #include <omni/fabric/FabricUSD.h>
 #include <omni/ui/ImageProvider/DynamicTextureProvider.h>
 
+#include <algorithm>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
 namespace cesium::omniverse {
 
 namespace {
 
+// A tile with a single primitive gains nothing from being split into tasks
+const size_t MIN_PARALLEL_PRIMITIVE_COUNT = 2;
+
 template <typename T> size_t getIndexFromRef(const std::vector<T>& vector, const T& item) {
     return static_cast<size_t>(&item - vector.data());
 };
@@ -48,11 +60,21 @@ struct MeshInfo {
     const uint64_t meshId;
     const uint64_t primitiveId;
     const bool smoothNormals;
+    const bool weldNormals;
+    const bool optimizeMeshes;
+    const PrimitiveDescriptor primitiveDescriptor;
+};
+
+struct IntermediateLoadThreadResult {
+    Cesium3DTilesSelection::TileLoadResult tileLoadResult;
+    std::vector<MeshInfo> meshes;
+    std::vector<FabricMesh> fabricMeshes;
 };
 
 struct TileLoadThreadResult {
     std::vector<MeshInfo> meshes;
     std::vector<FabricMesh> fabricMeshes;
+    std::vector<std::optional<FabricGeometryStaging>> geometryStagings;
     glm::dmat4 tileTransform;
 };
 
@@ -69,10 +91,8 @@ uint64_t getFeatureIdTextureCount(const FabricMesh& fabricMesh) {
     return static_cast<uint64_t>(std::count(featureIdTypes.begin(), featureIdTypes.end(), FeatureIdType::TEXTURE));
 }
 
-std::vector<const CesiumGltf::ImageCesium*> getPropertyTextureImages(
-    const FabricMesh& fabricMesh,
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive) {
+std::vector<const CesiumGltf::ImageCesium*>
+getPropertyTextureImages(const FabricMesh& fabricMesh, const PrimitiveDescriptor& primitiveDescriptor) {
     if (fabricMesh.material == nullptr) {
         return {};
     }
@@ -81,13 +101,11 @@ std::vector<const CesiumGltf::ImageCesium*> getPropertyTextureImages(
         return {};
     }
 
-    return MetadataUtil::getPropertyTextureImages(model, primitive);
+    return primitiveDescriptor.propertyTextureImages;
 }
 
-std::unordered_map<uint64_t, uint64_t> getPropertyTextureIndexMapping(
-    const FabricMesh& fabricMesh,
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive) {
+SmallMap<uint64_t, uint64_t>
+getPropertyTextureIndexMapping(const FabricMesh& fabricMesh, const PrimitiveDescriptor& primitiveDescriptor) {
     if (fabricMesh.material == nullptr) {
         return {};
     }
@@ -96,13 +114,10 @@ std::unordered_map<uint64_t, uint64_t> getPropertyTextureIndexMapping(
         return {};
     }
 
-    return MetadataUtil::getPropertyTextureIndexMapping(model, primitive);
+    return primitiveDescriptor.propertyTextureIndexMapping;
 }
 
-uint64_t getPropertyTableTextureCount(
-    const FabricMesh& fabricMesh,
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive) {
+uint64_t getPropertyTableTextureCount(const FabricMesh& fabricMesh, const PrimitiveDescriptor& primitiveDescriptor) {
     if (fabricMesh.material == nullptr) {
         return 0;
     }
@@ -111,7 +126,7 @@ uint64_t getPropertyTableTextureCount(
         return 0;
     }
 
-    return MetadataUtil::getPropertyTableTextureCount(model, primitive);
+    return primitiveDescriptor.propertyTableTextureCount;
 }
 
 std::vector<TextureData> encodePropertyTables(
@@ -130,15 +145,16 @@ std::vector<TextureData> encodePropertyTables(
 }
 
 std::vector<MeshInfo>
-gatherMeshes(const OmniTileset& tileset, const glm::dmat4& tileTransform, const CesiumGltf::Model& model) {
+gatherMeshes(const TilesetSnapshot& tileset, const glm::dmat4& tileTransform, const CesiumGltf::Model& model) {
     CESIUM_TRACE("FabricPrepareRenderResources::gatherMeshes");
-    const auto tilesetId = tileset.getTilesetId();
-
-    const auto smoothNormals = tileset.getSmoothNormals();
+    const auto tilesetId = tileset.tilesetId;
 
-    const auto georeferenceOrigin = GeospatialUtil::convertGeoreferenceToCartographic(tileset.getGeoreference());
-    const auto ecefToUsdTransform =
-        UsdUtil::computeEcefToUsdWorldTransformForPrim(georeferenceOrigin, tileset.getPath());
+    const auto smoothNormals = tileset.smoothNormals;
+    const auto weldNormals = tileset.weldNormals;
+    const auto renderPointsAsCubes = tileset.renderPointsAsCubes;
+    const auto optimizeMeshes = tileset.optimizeMeshes;
+    const auto& tilesetMaterialPath = tileset.materialPath;
+    const auto& ecefToUsdTransform = tileset.ecefToUsdTransform;
 
     auto gltfToEcefTransform = CesiumGltfContent::GltfUtilities::applyRtcCenter(model, tileTransform);
     gltfToEcefTransform = CesiumGltfContent::GltfUtilities::applyGltfUpAxisTransform(model, gltfToEcefTransform);
@@ -147,7 +163,15 @@ gatherMeshes(const OmniTileset& tileset, const glm::dmat4& tileTransform, const
 
     model.forEachPrimitiveInScene(
         -1,
-        [tilesetId, &ecefToUsdTransform, &gltfToEcefTransform, smoothNormals, &meshes](
+        [tilesetId,
+         &ecefToUsdTransform,
+         &gltfToEcefTransform,
+         smoothNormals,
+         weldNormals,
+         renderPointsAsCubes,
+         optimizeMeshes,
+         &tilesetMaterialPath,
+         &meshes](
             const CesiumGltf::Model& gltf,
             [[maybe_unused]] const CesiumGltf::Node& node,
             const CesiumGltf::Mesh& mesh,
@@ -163,54 +187,83 @@ gatherMeshes(const OmniTileset& tileset, const glm::dmat4& tileTransform, const
                 meshId,
                 primitiveId,
                 smoothNormals,
+                weldNormals,
+                optimizeMeshes,
+                createPrimitiveDescriptor(gltf, primitive, smoothNormals, renderPointsAsCubes, tilesetMaterialPath),
             });
         });
 
     return meshes;
 }
 
-std::vector<FabricMesh> acquireFabricMeshes(
-    const CesiumGltf::Model& model,
+// Continues from wherever a previous call stopped. When called from a worker thread, returns false as soon as a
+// geometry or material can't be acquired without creating Fabric prims so that the main thread can finish the job.
+bool acquireFabricMeshes(
     const std::vector<MeshInfo>& meshes,
     uint64_t imageryLayerCount,
-    const OmniTileset& tileset) {
+    const TilesetSnapshot& tileset,
+    bool inWorkerThread,
+    std::vector<FabricMesh>& fabricMeshes) {
     CESIUM_TRACE("FabricPrepareRenderResources::acquireFabricMeshes");
-    std::vector<FabricMesh> fabricMeshes;
     fabricMeshes.reserve(meshes.size());
 
     auto& fabricResourceManager = FabricResourceManager::getInstance();
-    const auto tilesetMaterialPath = tileset.getMaterialPath();
+    const auto& tilesetMaterialPath = tileset.materialPath;
+
+    // Checking the tileset material for Cesium nodes reads from Fabric
+    if (inWorkerThread && !tilesetMaterialPath.IsEmpty()) {
+        return false;
+    }
+
     const auto stageId = UsdUtil::getUsdStageId();
 
-    for (const auto& mesh : meshes) {
-        auto& fabricMesh = fabricMeshes.emplace_back();
+    // The last mesh may only have its geometry if the previous call stopped at its material
+    const auto firstMeshIndex = fabricMeshes.empty() ? 0 : fabricMeshes.size() - 1;
 
-        const auto& primitive = model.meshes[mesh.meshId].primitives[mesh.primitiveId];
+    for (auto i = firstMeshIndex; i < meshes.size(); i++) {
+        const auto& mesh = meshes[i];
+        auto& fabricMesh = i < fabricMeshes.size() ? fabricMeshes[i] : fabricMeshes.emplace_back();
 
-        const auto featuresInfo = GltfUtil::getFeaturesInfo(model, primitive);
+        const auto& primitiveDescriptor = mesh.primitiveDescriptor;
+        const auto& featuresInfo = primitiveDescriptor.featuresInfo;
 
-        const auto fabricGeometry =
-            fabricResourceManager.acquireGeometry(model, primitive, featuresInfo, mesh.smoothNormals, stageId);
-        fabricMesh.geometry = fabricGeometry;
+        if (fabricMesh.geometry == nullptr) {
+            if (inWorkerThread) {
+                fabricMesh.geometry = fabricResourceManager.tryAcquireGeometry(primitiveDescriptor);
+            } else {
+                fabricMesh.geometry = fabricResourceManager.acquireGeometry(primitiveDescriptor, stageId);
+            }
 
-        const auto shouldAcquireMaterial = FabricResourceManager::getInstance().shouldAcquireMaterial(
-            primitive, imageryLayerCount > 0, tilesetMaterialPath);
+            if (fabricMesh.geometry == nullptr) {
+                fabricMeshes.pop_back();
+                return false;
+            }
+        }
 
-        if (shouldAcquireMaterial) {
-            const auto materialInfo = GltfUtil::getMaterialInfo(model, primitive);
+        const auto shouldAcquireMaterial = FabricResourceManager::getInstance().shouldAcquireMaterial(
+            primitiveDescriptor, imageryLayerCount > 0, tilesetMaterialPath);
+
+        if (shouldAcquireMaterial && fabricMesh.material == nullptr) {
+            std::shared_ptr<FabricMaterial> fabricMaterial;
+
+            if (inWorkerThread) {
+                fabricMaterial = fabricResourceManager.tryAcquireMaterial(
+                    primitiveDescriptor, imageryLayerCount, tileset.tilesetId, tilesetMaterialPath);
+            } else {
+                fabricMaterial = fabricResourceManager.acquireMaterial(
+                    primitiveDescriptor,
+                    imageryLayerCount,
+                    stageId,
+                    tileset.tilesetId,
+                    tilesetMaterialPath);
+            }
 
-            const auto fabricMaterial = fabricResourceManager.acquireMaterial(
-                model,
-                primitive,
-                materialInfo,
-                featuresInfo,
-                imageryLayerCount,
-                stageId,
-                tileset.getTilesetId(),
-                tilesetMaterialPath);
+            if (fabricMaterial == nullptr) {
+                return false;
+            }
 
             fabricMesh.material = fabricMaterial;
-            fabricMesh.materialInfo = materialInfo;
+            fabricMesh.materialInfo = primitiveDescriptor.materialInfo;
             fabricMesh.featuresInfo = featuresInfo;
 
             if (hasBaseColorTexture(fabricMesh)) {
@@ -223,13 +276,13 @@ std::vector<FabricMesh> acquireFabricMeshes(
                 fabricMesh.featureIdTextures.emplace_back(fabricResourceManager.acquireTexture());
             }
 
-            const auto propertyTextureCount = getPropertyTextureImages(fabricMesh, model, primitive).size();
+            const auto propertyTextureCount = getPropertyTextureImages(fabricMesh, primitiveDescriptor).size();
             fabricMesh.propertyTextures.reserve(propertyTextureCount);
             for (uint64_t i = 0; i < propertyTextureCount; i++) {
                 fabricMesh.propertyTextures.emplace_back(fabricResourceManager.acquireTexture());
             }
 
-            const auto propertyTableTextureCount = getPropertyTableTextureCount(fabricMesh, model, primitive);
+            const auto propertyTableTextureCount = getPropertyTableTextureCount(fabricMesh, primitiveDescriptor);
             fabricMesh.propertyTableTextures.reserve(propertyTableTextureCount);
             for (uint64_t i = 0; i < propertyTableTextureCount; i++) {
                 fabricMesh.propertyTableTextures.emplace_back(fabricResourceManager.acquireTexture());
@@ -237,14 +290,11 @@ std::vector<FabricMesh> acquireFabricMeshes(
         }
 
         // Map glTF texcoord set index to primvar st index
-        const auto texcoordSetIndexes = GltfUtil::getTexcoordSetIndexes(model, primitive);
-        const auto imageryTexcoordSetIndexes = GltfUtil::getImageryTexcoordSetIndexes(model, primitive);
-
         uint64_t primvarStIndex = 0;
-        for (const auto gltfSetIndex : texcoordSetIndexes) {
+        for (const auto gltfSetIndex : primitiveDescriptor.texcoordSetIndexes) {
             fabricMesh.texcoordIndexMapping[gltfSetIndex] = primvarStIndex++;
         }
-        for (const auto gltfSetIndex : imageryTexcoordSetIndexes) {
+        for (const auto gltfSetIndex : primitiveDescriptor.imageryTexcoordSetIndexes) {
             fabricMesh.imageryTexcoordIndexMapping[gltfSetIndex] = primvarStIndex++;
         }
 
@@ -254,10 +304,10 @@ std::vector<FabricMesh> acquireFabricMeshes(
         fabricMesh.featureIdTextureSetIndexMapping = getSetIndexMapping(featuresInfo, FeatureIdType::TEXTURE);
 
         // Map glTF texture index to property texture index
-        fabricMesh.propertyTextureIndexMapping = getPropertyTextureIndexMapping(fabricMesh, model, primitive);
+        fabricMesh.propertyTextureIndexMapping = getPropertyTextureIndexMapping(fabricMesh, primitiveDescriptor);
     }
 
-    return fabricMeshes;
+    return true;
 }
 
 void setFabricTextures(
@@ -285,7 +335,7 @@ void setFabricTextures(
             mesh.featureIdTextures[j]->setImage(*featureIdTextureImage, TransferFunction::LINEAR);
         }
 
-        const auto propertyTextureImages = getPropertyTextureImages(mesh, model, primitive);
+        const auto propertyTextureImages = getPropertyTextureImages(mesh, meshInfo.primitiveDescriptor);
         const auto propertyTextureCount = propertyTextureImages.size();
         for (uint64_t j = 0; j < propertyTextureCount; j++) {
             mesh.propertyTextures[j]->setImage(*propertyTextureImages[j], TransferFunction::LINEAR);
@@ -299,17 +349,183 @@ void setFabricTextures(
     }
 }
 
+void freeFabricMeshes(const std::vector<FabricMesh>& fabricMeshes) {
+    auto& fabricResourceManager = FabricResourceManager::getInstance();
+
+    for (const auto& mesh : fabricMeshes) {
+        auto& geometry = mesh.geometry;
+        auto& material = mesh.material;
+        auto& baseColorTexture = mesh.baseColorTexture;
+
+        assert(geometry != nullptr);
+
+        fabricResourceManager.releaseGeometry(geometry);
+
+        if (material != nullptr) {
+            fabricResourceManager.releaseMaterial(material);
+        }
+
+        if (baseColorTexture != nullptr) {
+            fabricResourceManager.releaseTexture(baseColorTexture);
+        }
+    }
+}
+
+using LoadingTilesByFileName = std::unordered_map<std::string_view, std::vector<const LoadingTile*>>;
+
+const Cesium3DTilesSelection::Tile*
+findLoadingTile(std::string_view urlPath, const LoadingTilesByFileName& loadingTilesByFileName) {
+    const auto iter = loadingTilesByFileName.find(UriUtil::getFileName(urlPath));
+
+    if (iter == loadingTilesByFileName.end()) {
+        return nullptr;
+    }
+
+    const Cesium3DTilesSelection::Tile* pTile = nullptr;
+
+    for (const auto pLoadingTile : iter->second) {
+        if (!UriUtil::endsWithPathSuffix(urlPath, UriUtil::normalizeUrlSuffix(pLoadingTile->contentUri))) {
+            continue;
+        }
+
+        // Content URIs are relative, so the same one may belong to tiles from different external tilesets. The load
+        // stays unbound until only one of them is left loading.
+        if (pTile != nullptr) {
+            return nullptr;
+        }
+
+        pTile = pLoadingTile->pTile;
+    }
+
+    return pTile;
+}
+
+bool isCancelled(const std::shared_ptr<std::atomic<bool>>& pCancelled) {
+    return pCancelled->load(std::memory_order_acquire);
+}
+
+CesiumAsync::Future<Cesium3DTilesSelection::TileLoadResultAndRenderResources> cancelTileLoad(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    Cesium3DTilesSelection::TileLoadResult&& tileLoadResult,
+    std::vector<FabricMesh>&& fabricMeshes) {
+    // The tileset loads the tile again if it's needed later
+    auto retryLaterResult =
+        Cesium3DTilesSelection::TileLoadResult::createRetryLaterResult(std::move(tileLoadResult.pCompletedRequest));
+
+    if (fabricMeshes.empty()) {
+        return asyncSystem.createResolvedFuture(
+            Cesium3DTilesSelection::TileLoadResultAndRenderResources{std::move(retryLaterResult), nullptr});
+    }
+
+    // Pooled objects can only be released on the main thread
+    return asyncSystem.runInMainThread(
+        [fabricMeshes = std::move(fabricMeshes), retryLaterResult = std::move(retryLaterResult)]() mutable {
+            freeFabricMeshes(fabricMeshes);
+            return Cesium3DTilesSelection::TileLoadResultAndRenderResources{std::move(retryLaterResult), nullptr};
+        });
+}
+
+std::optional<FabricGeometryStaging> stageFabricGeometry(
+    const CesiumGltf::Model& model,
+    const MeshInfo& meshInfo,
+    const FabricMesh& fabricMesh) {
+    CESIUM_TRACE("FabricPrepareRenderResources::stageFabricGeometry");
+    const auto& primitive = model.meshes[meshInfo.meshId].primitives[meshInfo.primitiveId];
+
+    return fabricMesh.geometry->stageGeometry(
+        meshInfo.tilesetId,
+        meshInfo.ecefToUsdTransform,
+        meshInfo.gltfToEcefTransform,
+        meshInfo.nodeTransform,
+        model,
+        primitive,
+        fabricMesh.materialInfo,
+        meshInfo.smoothNormals,
+        meshInfo.weldNormals,
+        meshInfo.optimizeMeshes,
+        fabricMesh.texcoordIndexMapping,
+        fabricMesh.imageryTexcoordIndexMapping);
+}
+
+CesiumAsync::Future<Cesium3DTilesSelection::TileLoadResultAndRenderResources> stageFabricGeometries(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    Cesium3DTilesSelection::TileLoadResult&& tileLoadResult,
+    std::vector<MeshInfo>&& meshes,
+    std::vector<FabricMesh>&& fabricMeshes,
+    const glm::dmat4& transform,
+    const std::shared_ptr<std::atomic<bool>>& pCancelled,
+    SlabAllocator<TileLoadThreadResult>& tileLoadThreadResultAllocator) {
+    // Held in a shared pointer so that the model and meshes stay put while the staging tasks read them
+    auto pLoadThreadResult = std::make_shared<IntermediateLoadThreadResult>(
+        IntermediateLoadThreadResult{std::move(tileLoadResult), std::move(meshes), std::move(fabricMeshes)});
+
+    const auto createResult = [asyncSystem, pLoadThreadResult, pCancelled, transform, &tileLoadThreadResultAllocator](
+                                  std::vector<std::optional<FabricGeometryStaging>>&& geometryStagings) {
+        if (isCancelled(pCancelled)) {
+            return cancelTileLoad(
+                asyncSystem,
+                std::move(pLoadThreadResult->tileLoadResult),
+                std::move(pLoadThreadResult->fabricMeshes));
+        }
+
+        return asyncSystem.createResolvedFuture(Cesium3DTilesSelection::TileLoadResultAndRenderResources{
+            std::move(pLoadThreadResult->tileLoadResult),
+            tileLoadThreadResultAllocator.create(
+                std::move(pLoadThreadResult->meshes),
+                std::move(pLoadThreadResult->fabricMeshes),
+                std::move(geometryStagings),
+                transform),
+        });
+    };
+
+    const auto pModel = std::get_if<CesiumGltf::Model>(&pLoadThreadResult->tileLoadResult.contentKind);
+    const auto meshCount = pLoadThreadResult->meshes.size();
+
+    if (meshCount < MIN_PARALLEL_PRIMITIVE_COUNT) {
+        std::vector<std::optional<FabricGeometryStaging>> geometryStagings;
+        geometryStagings.reserve(meshCount);
+
+        for (size_t i = 0; i < meshCount && !isCancelled(pCancelled); i++) {
+            geometryStagings.push_back(
+                stageFabricGeometry(*pModel, pLoadThreadResult->meshes[i], pLoadThreadResult->fabricMeshes[i]));
+        }
+
+        return createResult(std::move(geometryStagings));
+    }
+
+    // Primitives are independent of each other so each one is converted in its own task. Tasks started here inherit
+    // the priority of the tile load.
+    std::vector<CesiumAsync::Future<std::optional<FabricGeometryStaging>>> futures;
+    futures.reserve(meshCount);
+
+    for (size_t i = 0; i < meshCount; i++) {
+        futures.push_back(asyncSystem.runInWorkerThread([pLoadThreadResult, pModel, pCancelled, i]() {
+            if (isCancelled(pCancelled)) {
+                return std::optional<FabricGeometryStaging>();
+            }
+
+            return stageFabricGeometry(*pModel, pLoadThreadResult->meshes[i], pLoadThreadResult->fabricMeshes[i]);
+        }));
+    }
+
+    return asyncSystem.all(std::move(futures)).thenImmediately(createResult);
+}
+
 void setFabricMeshes(
     const CesiumGltf::Model& model,
     const std::vector<MeshInfo>& meshes,
     std::vector<FabricMesh>& fabricMeshes,
-    const OmniTileset& tileset) {
+    std::vector<std::optional<FabricGeometryStaging>>& geometryStagings,
+    const OmniTileset& tileset,
+    double screenSpaceError) {
     CESIUM_TRACE("FabricPrepareRenderResources::setFabricMeshes");
 
     const auto& tilesetMaterialPath = tileset.getMaterialPath();
     const auto displayColor = tileset.getDisplayColor();
     const auto displayOpacity = tileset.getDisplayOpacity();
 
+    auto& fabricResourceManager = FabricResourceManager::getInstance();
+
     for (size_t i = 0; i < meshes.size(); i++) {
         const auto& meshInfo = meshes[i];
         const auto& primitive = model.meshes[meshInfo.meshId].primitives[meshInfo.primitiveId];
@@ -318,17 +534,11 @@ void setFabricMeshes(
         const auto& geometry = mesh.geometry;
         const auto& material = mesh.material;
 
-        geometry->setGeometry(
-            meshInfo.tilesetId,
-            meshInfo.ecefToUsdTransform,
-            meshInfo.gltfToEcefTransform,
-            meshInfo.nodeTransform,
-            model,
-            primitive,
-            mesh.materialInfo,
-            meshInfo.smoothNormals,
-            mesh.texcoordIndexMapping,
-            mesh.imageryTexcoordIndexMapping);
+        // Geometry is written along with every other tile's geometry at the end of the frame
+        auto& geometryStaging = geometryStagings[i];
+        if (geometryStaging.has_value()) {
+            fabricResourceManager.queueGeometry(geometry, std::move(geometryStaging.value()), screenSpaceError);
+        }
 
         if (material != nullptr) {
             material->setMaterial(
@@ -356,32 +566,24 @@ void setFabricMeshes(
     }
 }
 
-void freeFabricMeshes(const std::vector<FabricMesh>& fabricMeshes) {
-    auto& fabricResourceManager = FabricResourceManager::getInstance();
-
-    for (const auto& mesh : fabricMeshes) {
-        auto& geometry = mesh.geometry;
-        auto& material = mesh.material;
-        auto& baseColorTexture = mesh.baseColorTexture;
-
-        assert(geometry != nullptr);
-
-        fabricResourceManager.releaseGeometry(geometry);
-
-        if (material != nullptr) {
-            fabricResourceManager.releaseMaterial(material);
-        }
-
-        if (baseColorTexture != nullptr) {
-            fabricResourceManager.releaseTexture(baseColorTexture);
-        }
-    }
-}
-
 } // namespace
 
+// Tiles come and go constantly while the camera moves, so their results reuse the memory of freed tiles instead of
+// going back to the heap. The allocators belong to the preparer, which the tileset keeps alive until every result
+// has been freed.
+struct FabricPrepareRenderResources::Allocators {
+    SlabAllocator<TileLoadThreadResult> tileLoadThreadResults;
+    SlabAllocator<TileRenderResources> tileRenderResources;
+    SlabAllocator<ImageryLoadThreadResult> imageryLoadThreadResults;
+    SlabAllocator<ImageryRenderResources> imageryRenderResources;
+};
+
 FabricPrepareRenderResources::FabricPrepareRenderResources(const OmniTileset& tileset)
-    : _tileset(&tileset) {}
+    : _tileset(&tileset)
+    , _pTilesetPrimAlive(tileset.getPrimAliveFlag())
+    , _pAllocators(std::make_unique<Allocators>()) {}
+
+FabricPrepareRenderResources::~FabricPrepareRenderResources() = default;
 
 CesiumAsync::Future<Cesium3DTilesSelection::TileLoadResultAndRenderResources>
 FabricPrepareRenderResources::prepareInLoadThread(
@@ -403,23 +605,46 @@ FabricPrepareRenderResources::prepareInLoadThread(
     // We don't know how many imagery layers actually overlap this tile until attachRasterInMainThread is called
     // but at least we have an upper bound. Unused texture slots are initialized with a 1x1 transparent pixel so
     // blending still works.
+    const auto pTilesetSnapshot = getTilesetSnapshot();
     const auto overlapsImagery = tileLoadResult.rasterOverlayDetails.has_value();
-    const auto imageryLayerCount = overlapsImagery ? _tileset->getImageryLayerCount() : 0;
+    const auto imageryLayerCount = overlapsImagery ? pTilesetSnapshot->imageryLayerCount : 0;
 
-    auto meshes = gatherMeshes(*_tileset, transform, *pModel);
+    // Checked between stages so that a tile that stops being wanted while it's being prepared gives back its
+    // resources early
+    auto pCancelled = registerTileLoad(tileLoadResult);
 
-    struct IntermediateLoadThreadResult {
-        Cesium3DTilesSelection::TileLoadResult tileLoadResult;
-        std::vector<MeshInfo> meshes;
-        std::vector<FabricMesh> fabricMeshes;
-    };
+    auto meshes = gatherMeshes(*pTilesetSnapshot, transform, *pModel);
+
+    // Most tiles can take their geometry and materials from pools that the main thread has already grown, so the
+    // round trip to the main thread is only needed when a new pool or shared material has to be created
+    std::vector<FabricMesh> fabricMeshes;
+
+    if (acquireFabricMeshes(meshes, imageryLayerCount, *pTilesetSnapshot, true, fabricMeshes)) {
+        if (isCancelled(pCancelled)) {
+            return cancelTileLoad(asyncSystem, std::move(tileLoadResult), std::move(fabricMeshes));
+        }
+
+        setFabricTextures(*pModel, meshes, fabricMeshes);
+
+        return stageFabricGeometries(
+            asyncSystem,
+            std::move(tileLoadResult),
+            std::move(meshes),
+            std::move(fabricMeshes),
+            transform,
+            pCancelled);
+    }
 
     return asyncSystem
         .runInMainThread([this,
                           imageryLayerCount,
+                          pTilesetSnapshot,
+                          pCancelled,
                           meshes = std::move(meshes),
+                          fabricMeshes = std::move(fabricMeshes),
                           tileLoadResult = std::move(tileLoadResult)]() mutable {
-            if (!tilesetExists()) {
+            if (!tilesetExists() || isCancelled(pCancelled)) {
+                freeFabricMeshes(fabricMeshes);
                 return IntermediateLoadThreadResult{
                     std::move(tileLoadResult),
                     {},
@@ -427,32 +652,45 @@ FabricPrepareRenderResources::prepareInLoadThread(
                 };
             }
 
-            const auto pModel = std::get_if<CesiumGltf::Model>(&tileLoadResult.contentKind);
-            auto fabricMeshes = acquireFabricMeshes(*pModel, meshes, imageryLayerCount, *_tileset);
+            acquireFabricMeshes(meshes, imageryLayerCount, *pTilesetSnapshot, false, fabricMeshes);
             return IntermediateLoadThreadResult{
                 std::move(tileLoadResult),
                 std::move(meshes),
                 std::move(fabricMeshes),
             };
         })
-        .thenInWorkerThread([this, transform](IntermediateLoadThreadResult&& workerResult) mutable {
+        .thenInWorkerThread([this, asyncSystem, transform, pCancelled](
+                                IntermediateLoadThreadResult&& workerResult) mutable {
             auto tileLoadResult = std::move(workerResult.tileLoadResult);
             auto meshes = std::move(workerResult.meshes);
             auto fabricMeshes = std::move(workerResult.fabricMeshes);
             const auto pModel = std::get_if<CesiumGltf::Model>(&tileLoadResult.contentKind);
 
-            if (tilesetExists()) {
-                setFabricTextures(*pModel, meshes, fabricMeshes);
+            if (isCancelled(pCancelled)) {
+                return cancelTileLoad(asyncSystem, std::move(tileLoadResult), std::move(fabricMeshes));
             }
 
-            return Cesium3DTilesSelection::TileLoadResultAndRenderResources{
+            if (!tilesetExists()) {
+                return asyncSystem.createResolvedFuture(Cesium3DTilesSelection::TileLoadResultAndRenderResources{
+                    std::move(tileLoadResult),
+                    _pAllocators->tileLoadThreadResults.create(
+                        std::move(meshes),
+                        std::move(fabricMeshes),
+                        std::vector<std::optional<FabricGeometryStaging>>{},
+                        transform),
+                });
+            }
+
+            setFabricTextures(*pModel, meshes, fabricMeshes);
+
+            return stageFabricGeometries(
+                asyncSystem,
                 std::move(tileLoadResult),
-                new TileLoadThreadResult{
-                    std::move(meshes),
-                    std::move(fabricMeshes),
-                    transform,
-                },
-            };
+                std::move(meshes),
+                std::move(fabricMeshes),
+                transform,
+                pCancelled,
+                _pAllocators->tileLoadThreadResults);
         });
 }
 
@@ -462,10 +700,12 @@ void* FabricPrepareRenderResources::prepareInMainThread(Cesium3DTilesSelection::
     }
 
     // Wrap in a unique_ptr so that pLoadThreadResult gets freed when this function returns
-    std::unique_ptr<TileLoadThreadResult> pTileLoadThreadResult{static_cast<TileLoadThreadResult*>(pLoadThreadResult)};
+    const auto pTileLoadThreadResult =
+        _pAllocators->tileLoadThreadResults.adopt(static_cast<TileLoadThreadResult*>(pLoadThreadResult));
 
     const auto& meshes = pTileLoadThreadResult->meshes;
     auto& fabricMeshes = pTileLoadThreadResult->fabricMeshes;
+    auto& geometryStagings = pTileLoadThreadResult->geometryStagings;
     const auto& tileTransform = pTileLoadThreadResult->tileTransform;
 
     const auto& content = tile.getContent();
@@ -477,13 +717,13 @@ void* FabricPrepareRenderResources::prepareInMainThread(Cesium3DTilesSelection::
     const auto& model = pRenderContent->getModel();
 
     if (tilesetExists()) {
-        setFabricMeshes(model, meshes, fabricMeshes, *_tileset);
+        const auto startTime = std::chrono::steady_clock::now();
+        const auto screenSpaceError = _tileset->computeScreenSpaceError(tile);
+        setFabricMeshes(model, meshes, fabricMeshes, geometryStagings, *_tileset, screenSpaceError);
+        _mainThreadLoadingTime += std::chrono::steady_clock::now() - startTime;
     }
 
-    return new TileRenderResources{
-        tileTransform,
-        std::move(fabricMeshes),
-    };
+    return _pAllocators->tileRenderResources.create(tileTransform, std::move(fabricMeshes));
 }
 
 void FabricPrepareRenderResources::free(
@@ -493,13 +733,13 @@ void FabricPrepareRenderResources::free(
     if (pLoadThreadResult) {
         const auto pTileLoadThreadResult = static_cast<TileLoadThreadResult*>(pLoadThreadResult);
         freeFabricMeshes(pTileLoadThreadResult->fabricMeshes);
-        delete pTileLoadThreadResult;
+        _pAllocators->tileLoadThreadResults.destroy(pTileLoadThreadResult);
     }
 
     if (pMainThreadResult) {
         const auto pTileRenderResources = static_cast<TileRenderResources*>(pMainThreadResult);
         freeFabricMeshes(pTileRenderResources->fabricMeshes);
-        delete pTileRenderResources;
+        _pAllocators->tileRenderResources.destroy(pTileRenderResources);
     }
 }
 
@@ -513,7 +753,7 @@ void* FabricPrepareRenderResources::prepareRasterInLoadThread(
 
     auto texture = FabricResourceManager::getInstance().acquireTexture();
     texture->setImage(image, TransferFunction::SRGB);
-    return new ImageryLoadThreadResult{texture};
+    return _pAllocators->imageryLoadThreadResults.create(texture);
 }
 
 void* FabricPrepareRenderResources::prepareRasterInMainThread(
@@ -524,8 +764,8 @@ void* FabricPrepareRenderResources::prepareRasterInMainThread(
     }
 
     // Wrap in a unique_ptr so that pLoadThreadResult gets freed when this function returns
-    std::unique_ptr<ImageryLoadThreadResult> pImageryLoadThreadResult{
-        static_cast<ImageryLoadThreadResult*>(pLoadThreadResult)};
+    const auto pImageryLoadThreadResult =
+        _pAllocators->imageryLoadThreadResults.adopt(static_cast<ImageryLoadThreadResult*>(pLoadThreadResult));
 
     if (!tilesetExists()) {
         return nullptr;
@@ -533,7 +773,7 @@ void* FabricPrepareRenderResources::prepareRasterInMainThread(
 
     auto texture = pImageryLoadThreadResult->texture;
 
-    return new ImageryRenderResources{texture};
+    return _pAllocators->imageryRenderResources.create(texture);
 }
 
 void FabricPrepareRenderResources::freeRaster(
@@ -545,14 +785,14 @@ void FabricPrepareRenderResources::freeRaster(
         const auto pImageryLoadThreadResult = static_cast<ImageryLoadThreadResult*>(pLoadThreadResult);
         const auto texture = pImageryLoadThreadResult->texture;
         FabricResourceManager::getInstance().releaseTexture(texture);
-        delete pImageryLoadThreadResult;
+        _pAllocators->imageryLoadThreadResults.destroy(pImageryLoadThreadResult);
     }
 
     if (pMainThreadResult) {
         const auto pImageryRenderResources = static_cast<ImageryRenderResources*>(pMainThreadResult);
         const auto texture = pImageryRenderResources->texture;
         FabricResourceManager::getInstance().releaseTexture(texture);
-        delete pImageryRenderResources;
+        _pAllocators->imageryRenderResources.destroy(pImageryRenderResources);
     }
 }
 
@@ -647,13 +887,108 @@ void FabricPrepareRenderResources::detachRasterInMainThread(
 }
 
 bool FabricPrepareRenderResources::tilesetExists() const {
-    // When a tileset is deleted there's a short period between the prim being deleted and TfNotice notifying us about the change.
-    // This function helps us know whether we should proceed with loading render resources.
-    return _tileset != nullptr && UsdUtil::primExists(_tileset->getPath());
+    // When a tileset is deleted there's a short period between the prim being deleted and the tileset being removed.
+    // The prim alive flag is cleared as soon as TfNotice notifies us about the change so that loads in flight can stop
+    // without querying the stage.
+    return _tilesetAttached.load(std::memory_order_acquire) && _pTilesetPrimAlive->load(std::memory_order_acquire);
+}
+
+void FabricPrepareRenderResources::setTilesetSnapshot(std::shared_ptr<const TilesetSnapshot> pTilesetSnapshot) {
+    std::atomic_store(&_pTilesetSnapshot, std::move(pTilesetSnapshot));
+}
+
+std::shared_ptr<const TilesetSnapshot> FabricPrepareRenderResources::getTilesetSnapshot() const {
+    return std::atomic_load(&_pTilesetSnapshot);
 }
 
 void FabricPrepareRenderResources::detachTileset() {
+    _tilesetAttached.store(false, std::memory_order_release);
     _tileset = nullptr;
 }
 
+std::chrono::steady_clock::duration FabricPrepareRenderResources::takeMainThreadLoadingTime() {
+    return std::exchange(_mainThreadLoadingTime, std::chrono::steady_clock::duration::zero());
+}
+
+void FabricPrepareRenderResources::setTileScreenSpaceError(
+    const Cesium3DTilesSelection::Tile& tile,
+    double screenSpaceError) {
+    const auto pRenderContent = tile.getContent().getRenderContent();
+    if (!pRenderContent) {
+        return;
+    }
+
+    const auto pTileRenderResources = static_cast<TileRenderResources*>(pRenderContent->getRenderResources());
+    if (!pTileRenderResources) {
+        return;
+    }
+
+    auto& fabricResourceManager = FabricResourceManager::getInstance();
+
+    for (const auto& mesh : pTileRenderResources->fabricMeshes) {
+        if (mesh.geometry->getGeometryDefinition().isPoints()) {
+            fabricResourceManager.setPointScreenSpaceError(mesh.geometry, screenSpaceError);
+        }
+    }
+}
+
+void FabricPrepareRenderResources::cancelUnwantedTileLoads(const std::vector<LoadingTile>& loadingTiles) {
+    std::unordered_map<const Cesium3DTilesSelection::Tile*, const LoadingTile*> loadingTilesByTile;
+    LoadingTilesByFileName loadingTilesByFileName;
+
+    for (const auto& loadingTile : loadingTiles) {
+        loadingTilesByTile.emplace(loadingTile.pTile, &loadingTile);
+        loadingTilesByFileName[UriUtil::getFileName(UriUtil::normalizeUrlSuffix(loadingTile.contentUri))].push_back(
+            &loadingTile);
+    }
+
+    std::scoped_lock<std::mutex> lock(_tileLoadsMutex);
+
+    // Loads that have finished preparing are forgotten here rather than when they finish
+    _tileLoads.erase(
+        std::remove_if(
+            _tileLoads.begin(),
+            _tileLoads.end(),
+            [](const TileLoad& tileLoad) { return tileLoad.pCancelled.expired(); }),
+        _tileLoads.end());
+
+    for (auto& tileLoad : _tileLoads) {
+        if (tileLoad.pTile == nullptr) {
+            tileLoad.pTile = findLoadingTile(tileLoad.urlPath, loadingTilesByFileName);
+
+            if (tileLoad.pTile == nullptr) {
+                continue;
+            }
+        }
+
+        // A tile that is no longer loading was unloaded while it was being prepared
+        const auto iter = loadingTilesByTile.find(tileLoad.pTile);
+        const auto cancel = iter == loadingTilesByTile.end() || iter->second->cancel;
+
+        if (!cancel) {
+            continue;
+        }
+
+        if (const auto pCancelled = tileLoad.pCancelled.lock()) {
+            pCancelled->store(true, std::memory_order_release);
+        }
+    }
+}
+
+std::shared_ptr<std::atomic<bool>>
+FabricPrepareRenderResources::registerTileLoad(const Cesium3DTilesSelection::TileLoadResult& tileLoadResult) {
+    auto pCancelled = std::make_shared<std::atomic<bool>>(false);
+
+    // Without the request there's no way to match the load to its tile, so it's never cancelled
+    if (tileLoadResult.pCompletedRequest == nullptr) {
+        return pCancelled;
+    }
+
+    std::scoped_lock<std::mutex> lock(_tileLoadsMutex);
+    _tileLoads.push_back(
+        {std::string(UriUtil::getUrlPath(tileLoadResult.pCompletedRequest->url())), nullptr, pCancelled});
+
+    return pCancelled;
+}
+
 } // namespace cesium::omniverse
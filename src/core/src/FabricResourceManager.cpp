@@ -9,11 +9,15 @@
 #include "cesium/omniverse/FabricTexturePool.h"
 #include "cesium/omniverse/FabricUtil.h"
 #include "cesium/omniverse/GltfUtil.h"
+#include "cesium/omniverse/PrimitiveDescriptor.h"
 #include "cesium/omniverse/UsdUtil.h"
 
 #include <omni/ui/ImageProvider/DynamicTextureProvider.h>
 #include <spdlog/fmt/fmt.h>
 
+#include <algorithm>
+#include <chrono>
+
 namespace cesium::omniverse {
 
 namespace {
@@ -34,6 +38,29 @@ createSinglePixelTexture(const std::string& name, std::array<uint8_t, 4> bytes)
 const std::string DEFAULT_TEXTURE_NAME = "fabric_default_texture";
 const std::string DEFAULT_TRANSPARENT_TEXTURE_NAME = "fabric_default_transparent_texture";
 
+// Budgeted point clouds keep their points on the CPU so that they can be restored when budget frees up. Across all
+// point clouds that copy is capped at this many times the point budget.
+const uint64_t MAX_RETAINED_POINTS_PER_BUDGET_POINT = 4;
+
+// When pending geometry is written under a time limit the limit is checked after every batch of this many prims
+const uint64_t GEOMETRY_WRITE_BATCH_SIZE = 64;
+
+uint64_t getPointCountAtStride(uint64_t pointCount, uint64_t stride) {
+    return (pointCount + stride - 1) / stride;
+}
+
+// Picks the smallest power-of-two stride that fits the point cloud in the space left under the cap. Powers of two keep
+// the strides that the budget picks later a subset of the retained points.
+uint64_t getRetainedPointStride(uint64_t pointCount, uint64_t retainedPointCapacity) {
+    uint64_t stride = 1;
+
+    while (stride < pointCount && getPointCountAtStride(pointCount, stride) > retainedPointCapacity) {
+        stride *= 2;
+    }
+
+    return stride;
+}
+
 } // namespace
 
 FabricResourceManager::FabricResourceManager() {
@@ -48,7 +75,7 @@ FabricResourceManager::FabricResourceManager() {
 FabricResourceManager::~FabricResourceManager() = default;
 
 bool FabricResourceManager::shouldAcquireMaterial(
-    const CesiumGltf::MeshPrimitive& primitive,
+    const PrimitiveDescriptor& primitiveDescriptor,
     bool hasImagery,
     const pxr::SdfPath& tilesetMaterialPath) const {
     if (_disableMaterials) {
@@ -59,17 +86,13 @@ bool FabricResourceManager::shouldAcquireMaterial(
         return FabricUtil::materialHasCesiumNodes(FabricUtil::toFabricPath(tilesetMaterialPath));
     }
 
-    return hasImagery || GltfUtil::hasMaterial(primitive);
+    return hasImagery || primitiveDescriptor.hasMaterial;
 }
 
-std::shared_ptr<FabricGeometry> FabricResourceManager::acquireGeometry(
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive,
-    const FeaturesInfo& featuresInfo,
-    bool smoothNormals,
-    long stageId) {
+std::shared_ptr<FabricGeometry>
+FabricResourceManager::acquireGeometry(const PrimitiveDescriptor& primitiveDescriptor, long stageId) {
 
-    FabricGeometryDefinition geometryDefinition(model, primitive, featuresInfo, smoothNormals);
+    FabricGeometryDefinition geometryDefinition(primitiveDescriptor);
 
     if (_disableGeometryPool) {
         const auto pathStr = fmt::format("/fabric_geometry_{}", getNextGeometryId());
@@ -146,6 +169,7 @@ std::shared_ptr<FabricMaterial> FabricResourceManager::acquireSharedMaterial(
     const FabricMaterialDefinition& materialDefinition,
     long stageId,
     int64_t tilesetId) {
+    std::scoped_lock<std::mutex> lock(_poolMutex);
 
     const auto sharedMaterial = getSharedMaterial(materialInfo, tilesetId);
 
@@ -167,6 +191,8 @@ std::shared_ptr<FabricMaterial> FabricResourceManager::acquireSharedMaterial(
 }
 
 void FabricResourceManager::releaseSharedMaterial(const std::shared_ptr<FabricMaterial>& material) {
+    std::scoped_lock<std::mutex> lock(_poolMutex);
+
     const auto sharedMaterial = getSharedMaterial(material);
 
     assert(sharedMaterial != nullptr);
@@ -180,19 +206,16 @@ void FabricResourceManager::releaseSharedMaterial(const std::shared_ptr<FabricMa
 }
 
 std::shared_ptr<FabricMaterial> FabricResourceManager::acquireMaterial(
-    const CesiumGltf::Model& model,
-    const CesiumGltf::MeshPrimitive& primitive,
-    const MaterialInfo& materialInfo,
-    const FeaturesInfo& featuresInfo,
+    const PrimitiveDescriptor& primitiveDescriptor,
     uint64_t imageryLayerCount,
     long stageId,
     int64_t tilesetId,
     const pxr::SdfPath& tilesetMaterialPath) {
     FabricMaterialDefinition materialDefinition(
-        model, primitive, materialInfo, featuresInfo, imageryLayerCount, _disableTextures, tilesetMaterialPath);
+        primitiveDescriptor, imageryLayerCount, _disableTextures, tilesetMaterialPath);
 
     if (useSharedMaterial(materialDefinition)) {
-        return acquireSharedMaterial(materialInfo, materialDefinition, stageId, tilesetId);
+        return acquireSharedMaterial(primitiveDescriptor.materialInfo, materialDefinition, stageId, tilesetId);
     }
 
     if (_disableMaterialPool) {
@@ -231,7 +254,166 @@ std::shared_ptr<FabricTexture> FabricResourceManager::acquireTexture() {
     return texture;
 }
 
+std::shared_ptr<FabricGeometry>
+FabricResourceManager::tryAcquireGeometry(const PrimitiveDescriptor& primitiveDescriptor) {
+    if (_disableGeometryPool) {
+        return nullptr;
+    }
+
+    FabricGeometryDefinition geometryDefinition(primitiveDescriptor);
+
+    std::scoped_lock<std::mutex> lock(_poolMutex);
+
+    const auto geometryPool = getGeometryPool(geometryDefinition);
+
+    if (geometryPool == nullptr) {
+        return nullptr;
+    }
+
+    return geometryPool->tryAcquire();
+}
+
+std::shared_ptr<FabricMaterial> FabricResourceManager::tryAcquireMaterial(
+    const PrimitiveDescriptor& primitiveDescriptor,
+    uint64_t imageryLayerCount,
+    int64_t tilesetId,
+    const pxr::SdfPath& tilesetMaterialPath) {
+    FabricMaterialDefinition materialDefinition(
+        primitiveDescriptor, imageryLayerCount, _disableTextures, tilesetMaterialPath);
+
+    std::scoped_lock<std::mutex> lock(_poolMutex);
+
+    if (useSharedMaterial(materialDefinition)) {
+        const auto sharedMaterial = getSharedMaterial(primitiveDescriptor.materialInfo, tilesetId);
+
+        if (sharedMaterial == nullptr) {
+            return nullptr;
+        }
+
+        sharedMaterial->referenceCount++;
+        return sharedMaterial->material;
+    }
+
+    if (_disableMaterialPool) {
+        return nullptr;
+    }
+
+    const auto materialPool = getMaterialPool(materialDefinition);
+
+    if (materialPool == nullptr) {
+        return nullptr;
+    }
+
+    return materialPool->tryAcquire();
+}
+
+void FabricResourceManager::reservePoolCapacity() {
+    std::scoped_lock<std::mutex> lock(_poolMutex);
+
+    for (const auto& geometryPool : _geometryPools) {
+        geometryPool->reserve();
+    }
+
+    for (const auto& materialPool : _materialPools) {
+        materialPool->reserve();
+    }
+}
+
+void FabricResourceManager::queueGeometry(
+    const std::shared_ptr<FabricGeometry>& geometry,
+    FabricGeometryStaging&& staging,
+    double screenSpaceError) {
+    if (_pointBudget.getBudget() > 0 && geometry->getGeometryDefinition().isPoints()) {
+        const auto pathId = omni::fabric::PathC(geometry->getPath()).path;
+        removeBudgetedGeometry(pathId);
+
+        // Once the retained points reach the cap, point clouds only keep a strided subset of their points
+        const auto maxRetainedPointCount = _pointBudget.getBudget() * MAX_RETAINED_POINTS_PER_BUDGET_POINT;
+        const auto retainedPointCapacity =
+            maxRetainedPointCount > _retainedPointCount ? maxRetainedPointCount - _retainedPointCount : 0;
+        const auto pointCount = staging.points.size();
+        const auto retainedStride = getRetainedPointStride(pointCount, retainedPointCapacity);
+        const auto retainedPointCount = getPointCountAtStride(pointCount, retainedStride);
+
+        // The stride is picked in writePendingGeometries once every point cloud loaded this frame is known
+        _pointBudget.add(pathId, retainedPointCount, screenSpaceError);
+        _budgetedGeometries.insert_or_assign(pathId, BudgetedGeometry{geometry, retainedPointCount});
+        _retainedPointCount += retainedPointCount;
+        geometry->setPoints(std::move(staging), retainedStride);
+        return;
+    }
+
+    geometry->setGeometry(std::move(staging));
+    _pendingGeometries.push_back(geometry);
+}
+
+void FabricResourceManager::writePendingGeometries(double timeLimitMilliseconds) {
+    // Point clouds whose stride changed are rewritten in the same batch as newly loaded geometry
+    for (const auto& [pathId, stride] : _pointBudget.update()) {
+        const auto& geometry = _budgetedGeometries.at(pathId).geometry;
+        geometry->setPointStride(stride);
+        _pendingGeometries.push_back(geometry);
+    }
+
+    if (_pendingGeometries.empty()) {
+        return;
+    }
+
+    if (timeLimitMilliseconds == 0.0) {
+        FabricGeometry::writeGeometries(_pendingGeometries);
+        _pendingGeometries.clear();
+        return;
+    }
+
+    // At least one batch is written per call so that loading keeps making progress when the limit is already spent.
+    // Whatever is left stays queued for the next call.
+    const auto startTime = std::chrono::steady_clock::now();
+    const auto timeLimit = std::chrono::duration<double, std::milli>(timeLimitMilliseconds);
+    const auto pendingCount = static_cast<uint64_t>(_pendingGeometries.size());
+    std::vector<std::shared_ptr<FabricGeometry>> batch;
+    uint64_t writtenCount = 0;
+
+    do {
+        const auto batchEnd = std::min(writtenCount + GEOMETRY_WRITE_BATCH_SIZE, pendingCount);
+        batch.assign(
+            _pendingGeometries.begin() + static_cast<int64_t>(writtenCount),
+            _pendingGeometries.begin() + static_cast<int64_t>(batchEnd));
+        FabricGeometry::writeGeometries(batch);
+        writtenCount = batchEnd;
+    } while (writtenCount < pendingCount && std::chrono::steady_clock::now() - startTime < timeLimit);
+
+    _pendingGeometries.erase(
+        _pendingGeometries.begin(), _pendingGeometries.begin() + static_cast<int64_t>(writtenCount));
+}
+
+void FabricResourceManager::setPointBudget(uint64_t pointBudget) {
+    _pointBudget.setBudget(pointBudget);
+}
+
+uint64_t FabricResourceManager::getPointBudget() const {
+    return _pointBudget.getBudget();
+}
+
+void FabricResourceManager::setPointScreenSpaceError(
+    const std::shared_ptr<FabricGeometry>& geometry,
+    double screenSpaceError) {
+    _pointBudget.setWeight(omni::fabric::PathC(geometry->getPath()).path, screenSpaceError);
+}
+
+void FabricResourceManager::removeBudgetedGeometry(uint64_t pathId) {
+    const auto iter = _budgetedGeometries.find(pathId);
+    if (iter == _budgetedGeometries.end()) {
+        return;
+    }
+
+    _retainedPointCount -= iter->second.retainedPointCount;
+    _budgetedGeometries.erase(iter);
+    _pointBudget.remove(pathId);
+}
+
 void FabricResourceManager::releaseGeometry(const std::shared_ptr<FabricGeometry>& geometry) {
+    removeBudgetedGeometry(omni::fabric::PathC(geometry->getPath()).path);
+
     if (_disableGeometryPool) {
         return;
     }
@@ -329,10 +511,16 @@ void FabricResourceManager::updateShaderInput(
 }
 
 void FabricResourceManager::clear() {
+    std::scoped_lock<std::mutex> lock(_poolMutex);
+
     _geometryPools.clear();
     _materialPools.clear();
     _texturePools.clear();
     _sharedMaterials.clear();
+    _pendingGeometries.clear();
+    _pointBudget.clear();
+    _budgetedGeometries.clear();
+    _retainedPointCount = 0;
 }
 
 std::shared_ptr<FabricGeometryPool>
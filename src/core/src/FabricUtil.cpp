@@ -554,6 +554,10 @@ FabricStatistics getStatistics() {
         {omni::fabric::AttrNameAndType(FabricTypes::_cesium_tilesetId, FabricTokens::_cesium_tilesetId)},
         {omni::fabric::AttrNameAndType(FabricTypes::Mesh, FabricTokens::Mesh)});
 
+    const auto pointsBuckets = srw.findPrims(
+        {omni::fabric::AttrNameAndType(FabricTypes::_cesium_tilesetId, FabricTokens::_cesium_tilesetId)},
+        {omni::fabric::AttrNameAndType(FabricTypes::Points, FabricTokens::Points)});
+
     const auto materialBuckets = srw.findPrims(
         {omni::fabric::AttrNameAndType(FabricTypes::_cesium_tilesetId, FabricTokens::_cesium_tilesetId)},
         {omni::fabric::AttrNameAndType(FabricTypes::Material, FabricTokens::Material)});
@@ -586,6 +590,30 @@ FabricStatistics getStatistics() {
         }
     }
 
+    // Points prims have no triangles but still count as geometries
+    for (size_t bucketId = 0; bucketId < pointsBuckets.bucketCount(); bucketId++) {
+        auto paths = srw.getPathArray(pointsBuckets, bucketId);
+
+        // clang-format off
+        auto worldVisibilityFabric = srw.getAttributeArrayRd<bool>(pointsBuckets, bucketId, FabricTokens::_worldVisibility);
+        auto tilesetIdFabric = srw.getAttributeArrayRd<int64_t>(pointsBuckets, bucketId, FabricTokens::_cesium_tilesetId);
+        // clang-format on
+
+        statistics.geometriesCapacity += paths.size();
+
+        for (size_t i = 0; i < paths.size(); i++) {
+            if (tilesetIdFabric[i] == NO_TILESET_ID) {
+                continue;
+            }
+
+            statistics.geometriesLoaded++;
+
+            if (worldVisibilityFabric[i]) {
+                statistics.geometriesRendered++;
+            }
+        }
+    }
+
     for (size_t bucketId = 0; bucketId < materialBuckets.bucketCount(); bucketId++) {
         auto paths = srw.getPathArray(materialBuckets, bucketId);
 
@@ -0,0 +1,153 @@
+#include "cesium/omniverse/FileAssetAccessor.h"
+
+#include "cesium/omniverse/GzipUtil.h"
+#include "cesium/omniverse/MemoryMappedFile.h"
+#include "cesium/omniverse/TaskProcessor.h"
+#include "cesium/omniverse/UriUtil.h"
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/IAssetRequest.h>
+#include <CesiumAsync/IAssetResponse.h>
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace cesium::omniverse {
+
+namespace {
+
+const std::string_view FILE_SCHEME = "file://";
+
+class FileAssetResponse final : public CesiumAsync::IAssetResponse {
+  public:
+    FileAssetResponse(std::unique_ptr<MemoryMappedFile>&& pFile)
+        : _pFile(std::move(pFile)) {}
+
+    FileAssetResponse(std::vector<std::byte>&& inflatedData)
+        : _inflatedData(std::move(inflatedData)) {}
+
+    [[nodiscard]] uint16_t statusCode() const override {
+        return _pFile || _inflatedData.has_value() ? 200 : 404;
+    }
+
+    [[nodiscard]] std::string contentType() const override {
+        return "";
+    }
+
+    [[nodiscard]] const CesiumAsync::HttpHeaders& headers() const override {
+        return _headers;
+    }
+
+    [[nodiscard]] gsl::span<const std::byte> data() const override {
+        if (_inflatedData.has_value()) {
+            return {_inflatedData->data(), _inflatedData->size()};
+        }
+
+        if (!_pFile) {
+            return {};
+        }
+
+        return _pFile->getData();
+    }
+
+  private:
+    std::unique_ptr<MemoryMappedFile> _pFile;
+    std::optional<std::vector<std::byte>> _inflatedData;
+    CesiumAsync::HttpHeaders _headers;
+};
+
+class FileAssetRequest final : public CesiumAsync::IAssetRequest {
+  public:
+    FileAssetRequest(
+        std::string url,
+        const std::vector<CesiumAsync::IAssetAccessor::THeader>& headers,
+        FileAssetResponse&& response)
+        : _method{"GET"}
+        , _url{std::move(url)}
+        , _headers{headers.begin(), headers.end()}
+        , _response{std::move(response)} {}
+
+    [[nodiscard]] const std::string& method() const override {
+        return _method;
+    }
+
+    [[nodiscard]] const std::string& url() const override {
+        return _url;
+    }
+
+    [[nodiscard]] const CesiumAsync::HttpHeaders& headers() const override {
+        return _headers;
+    }
+
+    [[nodiscard]] const CesiumAsync::IAssetResponse* response() const override {
+        return &_response;
+    }
+
+  private:
+    std::string _method;
+    std::string _url;
+    CesiumAsync::HttpHeaders _headers;
+    FileAssetResponse _response;
+};
+
+} // namespace
+
+FileAssetAccessor::FileAssetAccessor(const std::shared_ptr<CesiumAsync::IAssetAccessor>& assetAccessor)
+    : _assetAccessor(assetAccessor) {}
+
+CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> FileAssetAccessor::get(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    const std::string& url,
+    const std::vector<THeader>& headers) {
+    auto localFilePath = UriUtil::getLocalPath(url, FILE_SCHEME);
+
+    if (!localFilePath.has_value()) {
+        return _assetAccessor->get(asyncSystem, url, headers);
+    }
+
+    // Opening and mapping the file can block on disk, so it happens on one of the threads reserved for blocking work
+    ScopedTaskPriority scopedPriority(TaskPriority::BLOCKING);
+
+    return asyncSystem.runInWorkerThread([url, headers, path = std::move(localFilePath.value())]() {
+        auto pFile = MemoryMappedFile::open(path);
+
+        if (pFile) {
+            const auto data = pFile->getData();
+            pFile->willNeed(0, data.size());
+
+            // Gzipped files are inflated the same way as gzipped HTTP responses. Only uncompressed files are served
+            // straight from the mapping.
+            if (GzipUtil::isGzip(data)) {
+                auto inflatedData = GzipUtil::gunzip(data);
+
+                if (inflatedData.has_value()) {
+                    return std::shared_ptr<CesiumAsync::IAssetRequest>(std::make_shared<FileAssetRequest>(
+                        url, headers, FileAssetResponse(std::move(inflatedData.value()))));
+                }
+            }
+        }
+
+        return std::shared_ptr<CesiumAsync::IAssetRequest>(
+            std::make_shared<FileAssetRequest>(url, headers, FileAssetResponse(std::move(pFile))));
+    });
+}
+
+CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> FileAssetAccessor::request(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    const std::string& verb,
+    const std::string& url,
+    const std::vector<THeader>& headers,
+    const gsl::span<const std::byte>& contentPayload) {
+    if (verb == "GET") {
+        return get(asyncSystem, url, headers);
+    }
+
+    return _assetAccessor->request(asyncSystem, verb, url, headers, contentPayload);
+}
+
+void FileAssetAccessor::tick() noexcept {
+    _assetAccessor->tick();
+}
+
+} // namespace cesium::omniverse
@@ -1,6 +1,146 @@
 #include "cesium/omniverse/GltfAccessors.h"
 
+#include "cesium/omniverse/SimdUtil.h"
+#include "cesium/omniverse/TaskProcessor.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <mutex>
+
 namespace cesium::omniverse {
+
+namespace {
+
+template <typename T, typename GetValue>
+void fillRepeated(const gsl::span<T>& values, uint64_t count, uint64_t repeat, const GetValue& getValue) {
+    for (uint64_t i = 0; i < count; i++) {
+        const auto value = getValue(static_cast<int64_t>(i));
+
+        for (uint64_t j = 0; j < repeat; j++) {
+            values[i * repeat + j] = value;
+        }
+    }
+}
+
+const uint64_t TRIANGLES_PER_CHUNK = 16384;
+const uint64_t VERTICES_PER_CHUNK = 65536;
+const uint64_t MAX_POOLED_NORMAL_BUFFERS = 32;
+const uint32_t EMPTY_SLOT = std::numeric_limits<uint32_t>::max();
+
+class NormalBufferPool {
+  public:
+    std::vector<glm::fvec3> acquire() {
+        std::scoped_lock<std::mutex> lock(_mutex);
+
+        if (_buffers.empty()) {
+            return {};
+        }
+
+        auto buffer = std::move(_buffers.back());
+        _buffers.pop_back();
+        return buffer;
+    }
+
+    void release(std::vector<glm::fvec3>&& buffer) {
+        std::scoped_lock<std::mutex> lock(_mutex);
+
+        if (_buffers.size() < MAX_POOLED_NORMAL_BUFFERS) {
+            _buffers.push_back(std::move(buffer));
+        }
+    }
+
+  private:
+    std::mutex _mutex;
+    std::vector<std::vector<glm::fvec3>> _buffers;
+};
+
+NormalBufferPool normalBufferPool;
+
+std::shared_ptr<std::vector<glm::fvec3>> acquireNormalBuffer(uint64_t size) {
+    auto pBuffer = new std::vector<glm::fvec3>(normalBufferPool.acquire());
+    pBuffer->assign(size, glm::fvec3(0.0f));
+
+    return {pBuffer, [](std::vector<glm::fvec3>* pReleased) {
+                normalBufferPool.release(std::move(*pReleased));
+                delete pReleased;
+            }};
+}
+
+glm::fvec3 normalizeOrZero(const glm::fvec3& v) {
+    const auto length = glm::length(v);
+    return length > 0.0f ? v / length : glm::fvec3(0.0f);
+}
+
+uint32_t hashPosition(const glm::fvec3& position) {
+    std::array<uint32_t, 3> bits{};
+
+    for (glm::length_t i = 0; i < 3; i++) {
+        // Adding zero turns -0 into +0 so that both hash the same, matching how they compare
+        const auto component = position[i] + 0.0f;
+        std::memcpy(&bits[static_cast<size_t>(i)], &component, sizeof(float));
+    }
+
+    auto hash = (bits[0] * 73856093u) ^ (bits[1] * 19349663u) ^ (bits[2] * 83492791u);
+    hash ^= hash >> 16;
+    return hash;
+}
+
+/**
+ * @brief Maps every vertex to the first vertex that has exactly the same position, using an open addressing hash
+ * table keyed on the position.
+ */
+void findCoincidentPositions(const PositionsAccessor& positions, std::vector<uint32_t>& representatives) {
+    const auto vertexCount = positions.size();
+
+    uint64_t tableSize = 1;
+    while (tableSize < vertexCount * 2) {
+        tableSize <<= 1;
+    }
+
+    const auto mask = tableSize - 1;
+
+    thread_local std::vector<uint32_t> table;
+    table.assign(tableSize, EMPTY_SLOT);
+    representatives.resize(vertexCount);
+
+    for (uint64_t i = 0; i < vertexCount; i++) {
+        const auto& position = positions.get(i);
+
+        for (auto slot = hashPosition(position) & mask;; slot = (slot + 1) & mask) {
+            const auto entry = table[slot];
+
+            if (entry == EMPTY_SLOT) {
+                table[slot] = static_cast<uint32_t>(i);
+                representatives[i] = static_cast<uint32_t>(i);
+                break;
+            }
+
+            if (positions.get(entry) == position) {
+                representatives[i] = entry;
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Splits [0, count) into chunks that laneCount lanes take turns claiming until none are left.
+ */
+template <typename F> void runChunked(uint64_t laneCount, uint64_t count, uint64_t chunkSize, const F& f) {
+    const auto chunkCount = (count + chunkSize - 1) / chunkSize;
+    std::atomic<uint64_t> nextChunk{0};
+
+    runParallel(laneCount, [&](uint64_t laneIndex) {
+        for (auto chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++) {
+            f(laneIndex, chunk * chunkSize, std::min((chunk + 1) * chunkSize, count));
+        }
+    });
+}
+
+} // namespace
+
 PositionsAccessor::PositionsAccessor()
     : _size(0) {}
 
@@ -30,14 +170,17 @@ IndicesAccessor::IndicesAccessor(uint64_t size)
 
 IndicesAccessor::IndicesAccessor(const CesiumGltf::AccessorView<uint8_t>& uint8View)
     : _uint8View(uint8View)
+    , _pPackedValues(getPackedValues(uint8View))
     , _size(static_cast<uint64_t>(uint8View.size())) {}
 
 IndicesAccessor::IndicesAccessor(const CesiumGltf::AccessorView<uint16_t>& uint16View)
     : _uint16View(uint16View)
+    , _pPackedValues(getPackedValues(uint16View))
     , _size(static_cast<uint64_t>(uint16View.size())) {}
 
 IndicesAccessor::IndicesAccessor(const CesiumGltf::AccessorView<uint32_t>& uint32View)
     : _uint32View(uint32View)
+    , _pPackedValues(getPackedValues(uint32View))
     , _size(static_cast<uint64_t>(uint32View.size())) {}
 
 template <typename T> IndicesAccessor IndicesAccessor::FromTriangleStrips(const CesiumGltf::AccessorView<T>& view) {
@@ -97,14 +240,30 @@ void IndicesAccessor::fill(const gsl::span<int>& values) const {
             values[i] = static_cast<int>(_computed[i]);
         }
     } else if (_uint8View.status() == CesiumGltf::AccessorViewStatus::Valid) {
+        if (_pPackedValues != nullptr) {
+            SimdUtil::convertUint8ToInt32(static_cast<const uint8_t*>(_pPackedValues), values.data(), size);
+            return;
+        }
+
         for (uint64_t i = 0; i < size; i++) {
             values[i] = static_cast<int>(_uint8View[static_cast<int64_t>(i)]);
         }
     } else if (_uint16View.status() == CesiumGltf::AccessorViewStatus::Valid) {
+        if (_pPackedValues != nullptr) {
+            SimdUtil::convertUint16ToInt32(static_cast<const uint16_t*>(_pPackedValues), values.data(), size);
+            return;
+        }
+
         for (uint64_t i = 0; i < size; i++) {
             values[i] = static_cast<int>(_uint16View[static_cast<int64_t>(i)]);
         }
     } else if (_uint32View.status() == CesiumGltf::AccessorViewStatus::Valid) {
+        if (_pPackedValues != nullptr) {
+            // Indices above the int range wrap the same way the cast below does
+            std::memcpy(values.data(), _pPackedValues, size * sizeof(int));
+            return;
+        }
+
         for (uint64_t i = 0; i < size; i++) {
             values[i] = static_cast<int>(_uint32View[static_cast<int64_t>(i)]);
         }
@@ -140,31 +299,95 @@ NormalsAccessor::NormalsAccessor(const CesiumGltf::AccessorView<glm::fvec3>& vie
     : _view(view)
     , _size(static_cast<uint64_t>(view.size())) {}
 
-NormalsAccessor NormalsAccessor::GenerateSmooth(const PositionsAccessor& positions, const IndicesAccessor& indices) {
-    auto normals = std::vector<glm::fvec3>(positions.size(), glm::fvec3(0.0f));
+NormalsAccessor NormalsAccessor::GenerateSmooth(
+    const PositionsAccessor& positions,
+    const IndicesAccessor& indices,
+    bool weldPositions) {
+    const auto vertexCount = positions.size();
+    const auto triangleCount = indices.size() / 3;
+
+    auto representatives = std::vector<uint32_t>();
+    if (weldPositions) {
+        findCoincidentPositions(positions, representatives);
+    }
 
-    for (uint64_t i = 0; i < indices.size(); i += 3) {
-        auto idx0 = static_cast<uint64_t>(indices.get(i));
-        auto idx1 = static_cast<uint64_t>(indices.get(i + 1));
-        auto idx2 = static_cast<uint64_t>(indices.get(i + 2));
+    const auto getTarget = [&representatives, weldPositions](uint32_t index) {
+        return weldPositions ? representatives[index] : index;
+    };
 
-        const auto& p0 = positions.get(idx0);
-        const auto& p1 = positions.get(idx1);
-        const auto& p2 = positions.get(idx2);
-        auto n = glm::normalize(glm::cross(p1 - p0, p2 - p0));
+    auto pNormals = acquireNormalBuffer(vertexCount);
+    auto& normals = *pNormals;
 
-        normals[idx0] += n;
-        normals[idx1] += n;
-        normals[idx2] += n;
-    }
+    // Each lane accumulates into its own buffer so that triangles sharing a vertex never race. Lane 0 accumulates
+    // straight into the output buffer and the other lanes clear theirs in parallel the first time they run.
+    const auto triangleChunkCount = (triangleCount + TRIANGLES_PER_CHUNK - 1) / TRIANGLES_PER_CHUNK;
+    const auto laneCount = std::max(std::min(getParallelLaneCount(), triangleChunkCount), uint64_t(1));
+
+    auto laneBuffers = std::vector<std::shared_ptr<std::vector<glm::fvec3>>>(laneCount);
+    laneBuffers[0] = pNormals;
+
+    runChunked(laneCount, triangleCount, TRIANGLES_PER_CHUNK, [&](uint64_t laneIndex, uint64_t begin, uint64_t end) {
+        auto& pLaneNormals = laneBuffers[laneIndex];
+        if (pLaneNormals == nullptr) {
+            pLaneNormals = acquireNormalBuffer(vertexCount);
+        }
+
+        auto& laneNormals = *pLaneNormals;
 
-    for (auto& n : normals) {
-        n = glm::normalize(n);
+        for (uint64_t i = begin; i < end; i++) {
+            const auto idx0 = indices.get(i * 3);
+            const auto idx1 = indices.get(i * 3 + 1);
+            const auto idx2 = indices.get(i * 3 + 2);
+
+            const auto& p0 = positions.get(idx0);
+            const auto& p1 = positions.get(idx1);
+            const auto& p2 = positions.get(idx2);
+            const auto n = normalizeOrZero(glm::cross(p1 - p0, p2 - p0));
+
+            laneNormals[getTarget(idx0)] += n;
+            laneNormals[getTarget(idx1)] += n;
+            laneNormals[getTarget(idx2)] += n;
+        }
+    });
+
+    const auto vertexChunkCount = (vertexCount + VERTICES_PER_CHUNK - 1) / VERTICES_PER_CHUNK;
+    const auto mergeLaneCount = std::max(std::min(getParallelLaneCount(), vertexChunkCount), uint64_t(1));
+
+    runChunked(mergeLaneCount, vertexCount, VERTICES_PER_CHUNK, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t i = 1; i < laneCount; i++) {
+            if (laneBuffers[i] == nullptr) {
+                continue;
+            }
+
+            const auto& laneNormals = *laneBuffers[i];
+
+            for (uint64_t j = begin; j < end; j++) {
+                normals[j] += laneNormals[j];
+            }
+        }
+
+        for (uint64_t j = begin; j < end; j++) {
+            normals[j] = normalizeOrZero(normals[j]);
+        }
+    });
+
+    // Welded vertices copy their representative's normal. This runs after every representative is normalized since
+    // a representative can be in a different chunk than the vertices that refer to it.
+    if (weldPositions) {
+        runChunked(mergeLaneCount, vertexCount, VERTICES_PER_CHUNK, [&](uint64_t, uint64_t begin, uint64_t end) {
+            for (uint64_t i = begin; i < end; i++) {
+                // A representative's own entry is skipped so that it's only ever read here while other chunks
+                // copy from it
+                if (representatives[i] != i) {
+                    normals[i] = normals[representatives[i]];
+                }
+            }
+        });
     }
 
     auto accessor = NormalsAccessor();
-    accessor._computed = std::move(normals);
-    accessor._size = indices.size();
+    accessor._pComputed = std::move(pNormals);
+    accessor._size = vertexCount;
     return accessor;
 }
 
@@ -172,10 +395,8 @@ void NormalsAccessor::fill(const gsl::span<glm::fvec3>& values) const {
     const auto size = values.size();
     assert(size == _size);
 
-    if (!_computed.empty()) {
-        for (uint64_t i = 0; i < size; i++) {
-            values[i] = _computed[i];
-        }
+    if (_pComputed != nullptr) {
+        std::memcpy(values.data(), _pComputed->data(), size * sizeof(glm::fvec3));
     } else {
         for (uint64_t i = 0; i < size; i++) {
             values[i] = _view[static_cast<int64_t>(i)];
@@ -192,6 +413,7 @@ TexcoordsAccessor::TexcoordsAccessor()
 
 TexcoordsAccessor::TexcoordsAccessor(const CesiumGltf::AccessorView<glm::fvec2>& view, bool flipVertical)
     : _view(view)
+    , _pPackedValues(getPackedValues(view))
     , _flipVertical(flipVertical)
     , _size(static_cast<uint64_t>(view.size())) {}
 
@@ -199,6 +421,17 @@ void TexcoordsAccessor::fill(const gsl::span<glm::fvec2>& values) const {
     const auto size = values.size();
     assert(size == _size);
 
+    if (_pPackedValues != nullptr && _flipVertical) {
+        SimdUtil::copyFlipVertical(
+            reinterpret_cast<const float*>(_pPackedValues), reinterpret_cast<float*>(values.data()), size);
+        return;
+    }
+
+    if (_pPackedValues != nullptr) {
+        std::memcpy(values.data(), _pPackedValues, size * sizeof(glm::fvec2));
+        return;
+    }
+
     for (uint64_t i = 0; i < size; i++) {
         values[i] = _view[static_cast<int64_t>(i)];
     }
@@ -223,6 +456,7 @@ VertexColorsAccessor::VertexColorsAccessor(const CesiumGltf::AccessorView<glm::u
 
 VertexColorsAccessor::VertexColorsAccessor(const CesiumGltf::AccessorView<glm::u8vec4>& uint8Vec4View)
     : _uint8Vec4View(uint8Vec4View)
+    , _pPackedValues(getPackedValues(uint8Vec4View))
     , _size(static_cast<uint64_t>(uint8Vec4View.size())) {}
 
 VertexColorsAccessor::VertexColorsAccessor(const CesiumGltf::AccessorView<glm::u16vec3>& uint16Vec3View)
@@ -231,6 +465,7 @@ VertexColorsAccessor::VertexColorsAccessor(const CesiumGltf::AccessorView<glm::u
 
 VertexColorsAccessor::VertexColorsAccessor(const CesiumGltf::AccessorView<glm::u16vec4>& uint16Vec4View)
     : _uint16Vec4View(uint16Vec4View)
+    , _pPackedValues(getPackedValues(uint16Vec4View))
     , _size(static_cast<uint64_t>(uint16Vec4View.size())) {}
 
 VertexColorsAccessor::VertexColorsAccessor(const CesiumGltf::AccessorView<glm::fvec3>& float32Vec3View)
@@ -248,47 +483,58 @@ void VertexColorsAccessor::fill(const gsl::span<glm::fvec4>& values, uint64_t re
     const auto size = values.size();
     assert(size == _size * repeat);
 
+    if (_pPackedValues != nullptr && repeat == 1) {
+        const auto pTarget = reinterpret_cast<float*>(values.data());
+
+        if (_uint8Vec4View.status() == CesiumGltf::AccessorViewStatus::Valid) {
+            SimdUtil::normalizeUint8Colors(static_cast<const uint8_t*>(_pPackedValues), pTarget, size);
+        } else if (_uint16Vec4View.status() == CesiumGltf::AccessorViewStatus::Valid) {
+            SimdUtil::normalizeUint16Colors(static_cast<const uint16_t*>(_pPackedValues), pTarget, size);
+        }
+
+        return;
+    }
+
     if (_uint8Vec3View.status() == CesiumGltf::AccessorViewStatus::Valid) {
-        for (uint64_t i = 0; i < size; i++) {
-            values[i] = glm::fvec4(
-                static_cast<float>(_uint8Vec3View[static_cast<int64_t>(i / repeat)].x) / MAX_UINT8,
-                static_cast<float>(_uint8Vec3View[static_cast<int64_t>(i / repeat)].y) / MAX_UINT8,
-                static_cast<float>(_uint8Vec3View[static_cast<int64_t>(i / repeat)].z) / MAX_UINT8,
+        fillRepeated(values, _size, repeat, [this](int64_t i) {
+            const auto& color = _uint8Vec3View[i];
+            return glm::fvec4(
+                static_cast<float>(color.x) / MAX_UINT8,
+                static_cast<float>(color.y) / MAX_UINT8,
+                static_cast<float>(color.z) / MAX_UINT8,
                 1.0);
-        }
+        });
     } else if (_uint8Vec4View.status() == CesiumGltf::AccessorViewStatus::Valid) {
-        for (uint64_t i = 0; i < size; i++) {
-            values[i] = glm::fvec4(
-                static_cast<float>(_uint8Vec4View[static_cast<int64_t>(i / repeat)].x) / MAX_UINT8,
-                static_cast<float>(_uint8Vec4View[static_cast<int64_t>(i / repeat)].y) / MAX_UINT8,
-                static_cast<float>(_uint8Vec4View[static_cast<int64_t>(i / repeat)].z) / MAX_UINT8,
-                static_cast<float>(_uint8Vec4View[static_cast<int64_t>(i / repeat)].w) / MAX_UINT8);
-        }
+        fillRepeated(values, _size, repeat, [this](int64_t i) {
+            const auto& color = _uint8Vec4View[i];
+            return glm::fvec4(
+                static_cast<float>(color.x) / MAX_UINT8,
+                static_cast<float>(color.y) / MAX_UINT8,
+                static_cast<float>(color.z) / MAX_UINT8,
+                static_cast<float>(color.w) / MAX_UINT8);
+        });
     } else if (_uint16Vec3View.status() == CesiumGltf::AccessorViewStatus::Valid) {
-        for (uint64_t i = 0; i < size; i++) {
-            values[i] = glm::fvec4(
-                static_cast<float>(_uint16Vec3View[static_cast<int64_t>(i / repeat)].x) / MAX_UINT16,
-                static_cast<float>(_uint16Vec3View[static_cast<int64_t>(i / repeat)].y) / MAX_UINT16,
-                static_cast<float>(_uint16Vec3View[static_cast<int64_t>(i / repeat)].z) / MAX_UINT16,
+        fillRepeated(values, _size, repeat, [this](int64_t i) {
+            const auto& color = _uint16Vec3View[i];
+            return glm::fvec4(
+                static_cast<float>(color.x) / MAX_UINT16,
+                static_cast<float>(color.y) / MAX_UINT16,
+                static_cast<float>(color.z) / MAX_UINT16,
                 1.0);
-        }
+        });
     } else if (_uint16Vec4View.status() == CesiumGltf::AccessorViewStatus::Valid) {
-        for (uint64_t i = 0; i < size; i++) {
-            values[i] = glm::fvec4(
-                static_cast<float>(_uint16Vec4View[static_cast<int64_t>(i / repeat)].x) / MAX_UINT16,
-                static_cast<float>(_uint16Vec4View[static_cast<int64_t>(i / repeat)].y) / MAX_UINT16,
-                static_cast<float>(_uint16Vec4View[static_cast<int64_t>(i / repeat)].z) / MAX_UINT16,
-                static_cast<float>(_uint16Vec4View[static_cast<int64_t>(i / repeat)].w) / MAX_UINT16);
-        }
+        fillRepeated(values, _size, repeat, [this](int64_t i) {
+            const auto& color = _uint16Vec4View[i];
+            return glm::fvec4(
+                static_cast<float>(color.x) / MAX_UINT16,
+                static_cast<float>(color.y) / MAX_UINT16,
+                static_cast<float>(color.z) / MAX_UINT16,
+                static_cast<float>(color.w) / MAX_UINT16);
+        });
     } else if (_float32Vec3View.status() == CesiumGltf::AccessorViewStatus::Valid) {
-        for (uint64_t i = 0; i < size; i++) {
-            values[i] = glm::fvec4(_float32Vec3View[static_cast<int64_t>(i / repeat)], 1.0f);
-        }
-
+        fillRepeated(values, _size, repeat, [this](int64_t i) { return glm::fvec4(_float32Vec3View[i], 1.0f); });
     } else if (_float32Vec4View.status() == CesiumGltf::AccessorViewStatus::Valid) {
-        for (uint64_t i = 0; i < size; i++) {
-            values[i] = _float32Vec4View[static_cast<int64_t>(i / repeat)];
-        }
+        fillRepeated(values, _size, repeat, [this](int64_t i) { return _float32Vec4View[i]; });
     }
 }
 
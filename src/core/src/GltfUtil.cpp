@@ -534,7 +534,8 @@ NormalsAccessor getNormals(
     const CesiumGltf::MeshPrimitive& primitive,
     const PositionsAccessor& positions,
     const IndicesAccessor& indices,
-    bool smoothNormals) {
+    bool smoothNormals,
+    bool weldNormals) {
 
     const auto normalsView = getNormalsView(model, primitive);
 
@@ -543,7 +544,7 @@ NormalsAccessor getNormals(
     }
 
     if (smoothNormals) {
-        return NormalsAccessor::GenerateSmooth(positions, indices);
+        return NormalsAccessor::GenerateSmooth(positions, indices, weldNormals);
     }
 
     // Otherwise if normals are missing and smoothNormals is false Omniverse will generate flat normals for us automatically
@@ -0,0 +1,112 @@
+#include "cesium/omniverse/GzipUtil.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace cesium::omniverse::GzipUtil {
+
+namespace {
+
+// A 10 byte header and an 8 byte trailer
+const size_t MIN_GZIP_SIZE = 18;
+
+// Typical tile content compresses well under this ratio. Anything larger grows the output geometrically instead of
+// trusting the trailer, which a corrupt or malicious response can set to anything up to 4 GiB.
+const uint64_t MAX_INITIAL_EXPANSION_RATIO = 64;
+
+uint64_t getUncompressedSizeHint(const gsl::span<const std::byte>& data) {
+    // The last four bytes of a gzip stream store the uncompressed size modulo 2^32 in little endian
+    const auto trailer = data.data() + data.size() - 4;
+    const auto size = static_cast<uint32_t>(trailer[0]) | static_cast<uint32_t>(trailer[1]) << 8 |
+                      static_cast<uint32_t>(trailer[2]) << 16 | static_cast<uint32_t>(trailer[3]) << 24;
+
+    return std::max(std::min(static_cast<uint64_t>(size), data.size() * MAX_INITIAL_EXPANSION_RATIO), uint64_t(1));
+}
+
+} // namespace
+
+bool isGzip(const gsl::span<const std::byte>& data) {
+    return data.size() >= MIN_GZIP_SIZE && data[0] == std::byte{0x1f} && data[1] == std::byte{0x8b};
+}
+
+std::optional<std::vector<std::byte>> gunzip(const gsl::span<const std::byte>& data) {
+    if (!isGzip(data)) {
+        return std::nullopt;
+    }
+
+    z_stream stream{};
+    if (inflateInit2(&stream, MAX_WBITS + 16) != Z_OK) {
+        return std::nullopt;
+    }
+
+    const auto maxChunkSize = static_cast<uint64_t>(std::numeric_limits<uInt>::max());
+    const auto pInputEnd = reinterpret_cast<const Bytef*>(data.data() + data.size());
+    stream.next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(data.data()));
+
+    std::vector<std::byte> output(getUncompressedSizeHint(data));
+    uint64_t outputSize = 0;
+
+    auto result = Z_OK;
+
+    while (true) {
+        if (outputSize == output.size()) {
+            output.resize(output.size() * 2);
+        }
+
+        // avail_in and avail_out are 32-bit, so very large streams are fed through in chunks
+        if (stream.avail_in == 0) {
+            const auto inputRemaining = static_cast<uint64_t>(pInputEnd - stream.next_in);
+            stream.avail_in = static_cast<uInt>(std::min(inputRemaining, maxChunkSize));
+        }
+
+        const auto outputChunkSize = static_cast<uInt>(std::min(output.size() - outputSize, maxChunkSize));
+        stream.next_out = reinterpret_cast<Bytef*>(output.data() + outputSize);
+        stream.avail_out = outputChunkSize;
+
+        result = inflate(&stream, Z_NO_FLUSH);
+        outputSize += outputChunkSize - stream.avail_out;
+
+        if (result == Z_STREAM_END) {
+            const auto inputRemaining = pInputEnd - stream.next_in;
+
+            if (inputRemaining >= 2 && stream.next_in[0] == 0x1f && stream.next_in[1] == 0x8b) {
+                // Concatenated gzip members
+                result = inflateReset(&stream);
+                if (result != Z_OK) {
+                    break;
+                }
+
+                continue;
+            }
+
+            break;
+        }
+
+        // Z_BUF_ERROR with a full output buffer only means that the output needs to grow. With output space left it
+        // means the input ended before the stream did.
+        const auto outputFull = stream.avail_out == 0;
+        if (result != Z_OK && !(result == Z_BUF_ERROR && outputFull)) {
+            break;
+        }
+
+        if (result == Z_OK && !outputFull && stream.avail_in == 0 && stream.next_in == pInputEnd) {
+            // Every byte was consumed without reaching the end of the stream
+            result = Z_BUF_ERROR;
+            break;
+        }
+    }
+
+    inflateEnd(&stream);
+
+    if (result != Z_STREAM_END) {
+        return std::nullopt;
+    }
+
+    output.resize(outputSize);
+    return output;
+}
+
+} // namespace cesium::omniverse::GzipUtil
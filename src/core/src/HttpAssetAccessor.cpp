@@ -1,133 +1,255 @@
 #include "cesium/omniverse/HttpAssetAccessor.h"
 
+#include "cesium/omniverse/GzipUtil.h"
 #include "cesium/omniverse/LoggerSink.h"
+#include "cesium/omniverse/SettingsWrapper.h"
+#include "cesium/omniverse/TaskProcessor.h"
+#include "cesium/omniverse/UriUtil.h"
 
+#include <CesiumAsync/AsyncSystem.h>
 #include <omni/kit/IApp.h>
-#include <zlib.h>
 
+#include <algorithm>
+#include <cstdlib>
 #include <exception>
+#include <iterator>
 #include <stdexcept>
+#include <string_view>
 
 namespace cesium::omniverse {
 namespace {
 
-const auto CPR_RESERVE_SIZE = 3145728; // 3 MiB
+const uint64_t MAX_CONTENT_LENGTH_RESERVATION = 64 * 1024 * 1024;
 
-std::string decodeGzip(std::string& content) {
-    z_stream zs; // z_stream is zlib's control structure
-    memset(&zs, 0, sizeof(zs));
+// curl_multi_poll also returns when curl_multi_wakeup is called, so this only bounds how long curl's own timeouts
+// wait to be serviced
+const int POLL_TIMEOUT_MILLISECONDS = 100;
 
-    if (inflateInit2(&zs, MAX_WBITS + 16) != Z_OK) {
+struct TransferResult {
+    uint16_t statusCode;
+    CesiumAsync::HttpHeaders headers;
+    std::vector<std::byte> data;
+};
+
+// Gzipped bodies are inflated whether or not the server set Content-Encoding. Data that fails to inflate is passed
+// through as is.
+std::vector<std::byte> decodeGzip(std::vector<std::byte>&& content) {
+    auto decoded = GzipUtil::gunzip(content);
+
+    if (!decoded.has_value()) {
         return std::move(content);
     }
 
-    zs.next_in = reinterpret_cast<Bytef*>(content.data());
-    zs.avail_in = static_cast<uInt>(content.size());
+    return std::move(decoded.value());
+}
 
-    int ret;
-    std::array<char, 32768> outbuffer;
-    std::string output;
+std::string_view trim(std::string_view str) {
+    const auto first = str.find_first_not_of(" \t\r\n");
 
-    // get the decompressed bytes blockwise using repeated calls to inflate
-    do {
-        zs.next_out = reinterpret_cast<Bytef*>(outbuffer.data());
-        zs.avail_out = sizeof(outbuffer);
+    if (first == std::string_view::npos) {
+        return {};
+    }
 
-        ret = inflate(&zs, 0);
+    const auto last = str.find_last_not_of(" \t\r\n");
+    return str.substr(first, last - first + 1);
+}
 
-        if (output.size() < zs.total_out) {
-            std::size_t decompressSoFar = output.size();
-            std::size_t addSize = zs.total_out - output.size();
-            output.resize(output.size() + addSize);
-            std::memcpy(output.data() + decompressSoFar, outbuffer.data(), addSize);
-        }
+curl_slist* createCurlHeaders(const std::vector<CesiumAsync::IAssetAccessor::THeader>& nativeHeaders) {
+    const auto app = carb::getCachedInterface<omni::kit::IApp>();
+    const auto& buildInfo = app->getBuildInfo();
+    const auto platformInfo = app->getPlatformInfo();
 
-    } while (ret == Z_OK);
+    curl_slist* headerList = nullptr;
 
-    inflateEnd(&zs);
+    const auto appendHeader = [&headerList](const std::string& key, const std::string& value) {
+        const auto header = fmt::format("{}: {}", key, value);
+        headerList = curl_slist_append(headerList, header.c_str());
+    };
 
-    if (ret != Z_STREAM_END) {
-        return std::move(content);
+    for (const auto& [key, value] : nativeHeaders) {
+        appendHeader(key, value);
     }
 
-    return output;
+    appendHeader("X-Cesium-Client", "Cesium for Omniverse");
+    appendHeader(
+        "X-Cesium-Client-Version", fmt::format("v{} {}", CESIUM_OMNI_VERSION, CESIUM_OMNI_GIT_HASH_ABBREVIATED));
+    appendHeader("X-Cesium-Client-Engine", fmt::format("Kit SDK {}", buildInfo.kitVersion));
+    appendHeader("X-Cesium-Client-OS", platformInfo.platform);
+
+    return headerList;
 }
 
-struct GZipDecompressInterceptor final : public cpr::Interceptor {
-  public:
-    GZipDecompressInterceptor(const std::filesystem::path& certificatePath)
-        : _certificatePath(certificatePath.generic_string()) {}
+enum class TransferPriorityClass {
+    UNKNOWN,
+    WANTED,
+    UNWANTED,
+};
 
-    cpr::Response intercept(cpr::Session& session) override {
-        curl_easy_setopt(session.GetCurlHolder()->handle, CURLOPT_CAINFO, _certificatePath.c_str());
-        curl_easy_setopt(session.GetCurlHolder()->handle, CURLOPT_ACCEPT_ENCODING, nullptr);
+TaskPriority getTaskPriority(TransferPriorityClass priorityClass) {
+    switch (priorityClass) {
+        case TransferPriorityClass::WANTED:
+            return TaskPriority::HIGH;
+        case TransferPriorityClass::UNWANTED:
+            return TaskPriority::LOW;
+        case TransferPriorityClass::UNKNOWN:
+            break;
+    }
 
-        CURLcode curl_error = curl_easy_perform(session.GetCurlHolder()->handle);
+    return TaskPriority::NORMAL;
+}
 
-        if (curl_error == CURLE_PEER_FAILED_VERIFICATION) {
-            long verifyResult;
-            curl_easy_getinfo(session.GetCurlHolder()->handle, CURLINFO_SSL_VERIFYRESULT, &verifyResult);
-            CESIUM_LOG_WARN("SSL PEER VERIFICATION FAILED: {}", verifyResult);
-        }
+std::string getCoalescingKey(
+    const std::string& url,
+    const std::vector<CesiumAsync::IAssetAccessor::THeader>& headers) {
+    // Header order doesn't matter, but names and values must match exactly for two requests to share a transfer
+    auto sortedHeaders = headers;
+    std::sort(sortedHeaders.begin(), sortedHeaders.end());
+
+    auto key = url;
 
-        auto response = session.Complete(curl_error);
-        response.text = decodeGzip(response.text);
-        return response;
+    for (const auto& [name, value] : sortedHeaders) {
+        key.append("\n").append(name).append(": ").append(value);
     }
 
-  private:
-    std::string _certificatePath;
+    return key;
+}
+
+struct TransferResponse {
+    CesiumAsync::HttpHeaders headers;
+    std::vector<std::byte> data;
 };
 
-cpr::Header createCprHeader(const std::vector<CesiumAsync::IAssetAccessor::THeader>& nativeHeaders) {
-    cpr::Header cprHeader;
+size_t writeCallback(char* buffer, size_t size, size_t count, void* userData) {
+    auto& response = *static_cast<TransferResponse*>(userData);
+    const auto length = size * count;
+    const auto bytes = reinterpret_cast<const std::byte*>(buffer);
+    response.data.insert(response.data.end(), bytes, bytes + length);
+    return length;
+}
 
-    const auto app = carb::getCachedInterface<omni::kit::IApp>();
-    const auto& buildInfo = app->getBuildInfo();
-    const auto platformInfo = app->getPlatformInfo();
+size_t headerCallback(char* buffer, size_t size, size_t count, void* userData) {
+    auto& response = *static_cast<TransferResponse*>(userData);
+    const auto length = size * count;
+    const auto line = std::string_view(buffer, length);
+
+    if (line.rfind("HTTP/", 0) == 0) {
+        // A new status line starts a new set of headers, e.g. after a redirect
+        response.headers.clear();
+        return length;
+    }
+
+    const auto colon = line.find(':');
+
+    if (colon == std::string_view::npos) {
+        return length;
+    }
+
+    const auto key = std::string(trim(line.substr(0, colon)));
+    const auto value = std::string(trim(line.substr(colon + 1)));
+
+    if (curl_strequal(key.c_str(), "content-length")) {
+        // Reserve the body up front so that the write callback doesn't need to reallocate. The header is untrusted,
+        // so larger bodies grow as they arrive instead.
+        const auto contentLength = std::strtoull(value.c_str(), nullptr, 10);
+        response.data.reserve(std::min(static_cast<uint64_t>(contentLength), MAX_CONTENT_LENGTH_RESERVATION));
+    }
 
-    cprHeader.insert(nativeHeaders.begin(), nativeHeaders.end());
-    cprHeader.insert(std::make_pair("X-Cesium-Client", "Cesium for Omniverse"));
-    cprHeader.insert(std::make_pair(
-        "X-Cesium-Client-Version", fmt::format("v{} {}", CESIUM_OMNI_VERSION, CESIUM_OMNI_GIT_HASH_ABBREVIATED)));
-    cprHeader.insert(std::make_pair("X-Cesium-Client-Engine", fmt::format("Kit SDK {}", buildInfo.kitVersion)));
-    cprHeader.insert(std::make_pair("X-Cesium-Client-OS", platformInfo.platform));
+    response.headers.insert_or_assign(key, value);
 
-    return cprHeader;
+    return length;
 }
 
 } // namespace
 
-HttpAssetAccessor::HttpAssetAccessor(const std::filesystem::path& certificatePath) {
-    _interceptor = std::make_shared<GZipDecompressInterceptor>(certificatePath);
+struct HttpAssetAccessor::Transfer {
+    CesiumAsync::AsyncSystem asyncSystem;
+    std::string method;
+    std::string url;
+    std::vector<THeader> headers;
+    std::vector<std::byte> payload;
+    CesiumAsync::Promise<TransferResult> promise;
+    uint64_t sequenceNumber;
+    std::string path;
+    std::string coalescingKey;
+    TransferPriorityClass priorityClass{TransferPriorityClass::UNKNOWN};
+    double priority{0.0};
+    curl_slist* headerList{nullptr};
+    TransferResponse response;
+};
+
+HttpAssetAccessor::HttpAssetAccessor(const std::filesystem::path& certificatePath)
+    : _certificatePath(certificatePath.generic_string())
+    , _http2Enabled(Settings::getHttp2Enabled())
+    , _maxActiveTransfers(Settings::getMaxActiveRequests()) {
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+
+    // All curl calls other than curl_multi_wakeup happen on the transfer thread so the share handle doesn't need lock
+    // callbacks
+    _shareHandle = curl_share_init();
+    curl_share_setopt(_shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(_shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+
+    _multiHandle = curl_multi_init();
+    curl_multi_setopt(
+        _multiHandle, CURLMOPT_MAX_HOST_CONNECTIONS, static_cast<long>(Settings::getMaxConnectionsPerHost()));
+
+    if (_http2Enabled) {
+        curl_multi_setopt(_multiHandle, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+        curl_multi_setopt(
+            _multiHandle, CURLMOPT_MAX_CONCURRENT_STREAMS, static_cast<long>(Settings::getMaxConcurrentStreams()));
+    } else {
+        curl_multi_setopt(_multiHandle, CURLMOPT_PIPELINING, CURLPIPE_NOTHING);
+    }
+
+    _transferThread = std::thread([this]() { run(); });
+}
+
+HttpAssetAccessor::~HttpAssetAccessor() {
+    {
+        std::scoped_lock<std::mutex> lock(_pendingMutex);
+        _stopping = true;
+    }
+
+    curl_multi_wakeup(_multiHandle);
+    _transferThread.join();
+
+    for (auto& [easyHandle, transfer] : _activeTransfers) {
+        curl_multi_remove_handle(_multiHandle, easyHandle);
+        curl_easy_cleanup(easyHandle);
+        curl_slist_free_all(transfer->headerList);
+    }
+
+    for (const auto easyHandle : _idleEasyHandles) {
+        curl_easy_cleanup(easyHandle);
+    }
+
+    curl_multi_cleanup(_multiHandle);
+    curl_share_cleanup(_shareHandle);
+    curl_global_cleanup();
 }
 
 CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> HttpAssetAccessor::get(
     const CesiumAsync::AsyncSystem& asyncSystem,
     const std::string& url,
     const std::vector<THeader>& headers) {
-    auto promise = asyncSystem.createPromise<std::shared_ptr<CesiumAsync::IAssetRequest>>();
-    const auto cprHeader = createCprHeader(headers);
-    std::shared_ptr<cpr::Session> session = std::make_shared<cpr::Session>();
-    session->AddInterceptor(_interceptor);
-    session->SetHeader(cprHeader);
+    auto coalescingKey = getCoalescingKey(url, headers);
 
-    // TLS 1.3 is not enabled by default.
-    auto sslOptions = cpr::Ssl(cpr::ssl::MaxTLSv1_3{});
-    session->SetSslOptions(sslOptions);
-
-    session->SetUrl(cpr::Url(url));
-    session->SetReserveSize(CPR_RESERVE_SIZE);
-    session->GetCallback([promise, url, headers](cpr::Response&& response) mutable {
-        if (response.error) {
-            promise.reject(
-                std::runtime_error(fmt::format("Request to {} failed with error: {}", url, response.error.message)));
-        } else {
-            promise.resolve(std::make_shared<HttpAssetRequest>("GET", url, headers, std::move(response)));
-        }
-    });
+    // The lock is held until the new transfer is registered so that it can't complete and be unregistered first
+    std::scoped_lock<std::mutex> lock(_inFlightRequestsMutex);
 
-    return promise.getFuture();
+    const auto iter = _inFlightRequests.find(coalescingKey);
+
+    if (iter != _inFlightRequests.end()) {
+        _requestsCoalesced++;
+        return iter->second.thenImmediately(
+            [](const std::shared_ptr<CesiumAsync::IAssetRequest>& pRequest) { return pRequest; });
+    }
+
+    auto future = enqueue(asyncSystem, "GET", url, headers, {}, std::string(coalescingKey)).share();
+    _inFlightRequests.insert({std::move(coalescingKey), future});
+
+    return future.thenImmediately(
+        [](const std::shared_ptr<CesiumAsync::IAssetRequest>& pRequest) { return pRequest; });
 }
 
 CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> HttpAssetAccessor::request(
@@ -136,36 +258,378 @@ CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> HttpAssetAccess
     const std::string& url,
     const std::vector<THeader>& headers,
     const gsl::span<const std::byte>& contentPayload) {
-    auto promise = asyncSystem.createPromise<std::shared_ptr<CesiumAsync::IAssetRequest>>();
-    const auto cprHeader = createCprHeader(headers);
-    std::shared_ptr<cpr::Session> session = std::make_shared<cpr::Session>();
-    session->SetHeader(cprHeader);
+    if (verb == "GET") {
+        return get(asyncSystem, url, headers);
+    }
 
-    // TLS 1.3 is not enabled by default.
-    auto sslOptions = cpr::Ssl(cpr::ssl::MaxTLSv1_3{});
-    session->SetSslOptions(sslOptions);
+    if (verb == "POST") {
+        return enqueue(asyncSystem, verb, url, headers, contentPayload, {});
+    }
 
-    session->SetUrl(cpr::Url(url));
-    session->SetReserveSize(CPR_RESERVE_SIZE);
-    session->AddInterceptor(_interceptor);
+    return asyncSystem.createResolvedFuture<std::shared_ptr<CesiumAsync::IAssetRequest>>(nullptr);
+}
 
-    if (verb == "GET") {
-        session->GetCallback([promise, url, headers](cpr::Response&& response) mutable {
-            promise.resolve(std::make_shared<HttpAssetRequest>("GET", url, headers, std::move(response)));
-        });
+void HttpAssetAccessor::tick() noexcept {}
+
+void HttpAssetAccessor::run() {
+    while (true) {
+        const auto queueChanged = takePendingWork();
+
+        {
+            std::scoped_lock<std::mutex> lock(_pendingMutex);
+            if (_stopping) {
+                return;
+            }
+        }
 
-        return promise.getFuture();
-    } else if (verb == "POST") {
-        session->SetBody(cpr::Body{reinterpret_cast<const char*>(contentPayload.data()), contentPayload.size()});
-        session->PostCallback([promise, url, headers](cpr::Response&& response) mutable {
-            promise.resolve(std::make_shared<HttpAssetRequest>("POST", url, headers, std::move(response)));
+        if (queueChanged && !_queuedTransfers.empty()) {
+            updateQueuedTransfers();
+            preemptUnwantedTransfers();
+        }
+
+        if (!_activeTransfers.empty()) {
+            int runningHandles = 0;
+            curl_multi_perform(_multiHandle, &runningHandles);
+            completeTransfers();
+        }
+
+        // Fill slots freed by completed transfers before waiting. New handles make curl_multi_poll return right away.
+        if (!_queuedTransfers.empty()) {
+            startQueuedTransfers();
+        }
+
+        curl_multi_poll(_multiHandle, nullptr, 0, POLL_TIMEOUT_MILLISECONDS, nullptr);
+    }
+}
+
+bool HttpAssetAccessor::takePendingWork() {
+    std::vector<std::unique_ptr<Transfer>> pendingTransfers;
+    std::unordered_map<int64_t, std::optional<std::vector<RequestPriorityHint>>> pendingRequestPriorityHints;
+
+    {
+        std::scoped_lock<std::mutex> lock(_pendingMutex);
+        std::swap(pendingTransfers, _pendingTransfers);
+        std::swap(pendingRequestPriorityHints, _pendingRequestPriorityHints);
+    }
+
+    for (auto& [sourceId, hints] : pendingRequestPriorityHints) {
+        if (hints.has_value()) {
+            _requestPriorityHints.insert_or_assign(sourceId, std::move(hints.value()));
+        } else {
+            _requestPriorityHints.erase(sourceId);
+        }
+    }
+
+    const auto queueChanged = !pendingTransfers.empty() || !pendingRequestPriorityHints.empty();
+    std::move(pendingTransfers.begin(), pendingTransfers.end(), std::back_inserter(_queuedTransfers));
+
+    return queueChanged;
+}
+
+CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> HttpAssetAccessor::enqueue(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    const std::string& verb,
+    const std::string& url,
+    const std::vector<THeader>& headers,
+    const gsl::span<const std::byte>& contentPayload,
+    std::string&& coalescingKey) {
+    auto promise = asyncSystem.createPromise<TransferResult>();
+    auto future = promise.getFuture();
+
+    {
+        std::scoped_lock<std::mutex> lock(_pendingMutex);
+        _pendingTransfers.emplace_back(std::make_unique<Transfer>(Transfer{
+            asyncSystem,
+            verb,
+            url,
+            headers,
+            std::vector<std::byte>(contentPayload.begin(), contentPayload.end()),
+            std::move(promise),
+            _nextSequenceNumber++,
+            std::string(UriUtil::getUrlPath(url)),
+            std::move(coalescingKey),
+        }));
+    }
+
+    curl_multi_wakeup(_multiHandle);
+
+    // Decompression happens in a worker thread since promises are resolved in the main thread. The decoded buffer is
+    // moved into the response without further copies.
+    return std::move(future).thenInWorkerThread([verb, url, headers](TransferResult&& result) mutable {
+        auto response =
+            HttpAssetResponse(result.statusCode, std::move(result.headers), decodeGzip(std::move(result.data)));
+        return std::shared_ptr<CesiumAsync::IAssetRequest>(
+            std::make_shared<HttpAssetRequest>(std::move(verb), url, headers, std::move(response)));
+    });
+}
+
+void HttpAssetAccessor::updateQueuedTransfers() {
+    // Index the hints by file name so that each transfer only needs to be compared against a few candidates
+    std::unordered_map<std::string_view, std::vector<const RequestPriorityHint*>> hintsByFileName;
+
+    for (const auto& [sourceId, hints] : _requestPriorityHints) {
+        for (const auto& hint : hints) {
+            hintsByFileName[UriUtil::getFileName(UriUtil::normalizeUrlSuffix(hint.urlSuffix))].push_back(&hint);
+        }
+    }
+
+    const auto updateTransfer = [&hintsByFileName](Transfer& transfer) {
+        transfer.priorityClass = TransferPriorityClass::UNKNOWN;
+        transfer.priority = 0.0;
+
+        const auto iter = hintsByFileName.find(UriUtil::getFileName(transfer.path));
+
+        if (iter == hintsByFileName.end()) {
+            return;
+        }
+
+        for (const auto pHint : iter->second) {
+            if (!UriUtil::endsWithPathSuffix(transfer.path, UriUtil::normalizeUrlSuffix(pHint->urlSuffix))) {
+                continue;
+            }
+
+            // The same resource may be requested by several tilesets. Use the most important hint.
+            const auto priorityClass = pHint->wanted ? TransferPriorityClass::WANTED : TransferPriorityClass::UNWANTED;
+
+            if (transfer.priorityClass == TransferPriorityClass::UNKNOWN || priorityClass < transfer.priorityClass ||
+                (priorityClass == transfer.priorityClass && pHint->priority > transfer.priority)) {
+                transfer.priorityClass = priorityClass;
+                transfer.priority = pHint->priority;
+            }
+        }
+    };
+
+    for (const auto& transfer : _queuedTransfers) {
+        updateTransfer(*transfer);
+    }
+
+    for (const auto& [easyHandle, transfer] : _activeTransfers) {
+        updateTransfer(*transfer);
+    }
+
+    std::sort(
+        _queuedTransfers.begin(),
+        _queuedTransfers.end(),
+        [](const std::unique_ptr<Transfer>& a, const std::unique_ptr<Transfer>& b) {
+            if (a->priorityClass != b->priorityClass) {
+                return a->priorityClass < b->priorityClass;
+            }
+
+            if (a->priority != b->priority) {
+                return a->priority > b->priority;
+            }
+
+            return a->sequenceNumber < b->sequenceNumber;
         });
+}
 
-        return promise.getFuture();
+void HttpAssetAccessor::preemptUnwantedTransfers() {
+    if (_activeTransfers.size() < _maxActiveTransfers ||
+        _queuedTransfers.front()->priorityClass == TransferPriorityClass::UNWANTED) {
+        return;
     }
 
-    return asyncSystem.createResolvedFuture<std::shared_ptr<CesiumAsync::IAssetRequest>>(nullptr);
+    const auto queuedCount = static_cast<uint64_t>(std::count_if(
+        _queuedTransfers.begin(), _queuedTransfers.end(), [](const std::unique_ptr<Transfer>& transfer) {
+            return transfer->priorityClass != TransferPriorityClass::UNWANTED;
+        }));
+
+    // Cancel in-flight transfers for tiles that are no longer wanted to make room for ones that are. The transfers
+    // go back into the queue rather than being rejected since cesium-native would otherwise mark the tile as
+    // failed and never load it again.
+    std::vector<CURL*> preemptedHandles;
+
+    for (const auto& [easyHandle, transfer] : _activeTransfers) {
+        if (preemptedHandles.size() == queuedCount) {
+            break;
+        }
+
+        if (transfer->priorityClass == TransferPriorityClass::UNWANTED) {
+            preemptedHandles.push_back(easyHandle);
+        }
+    }
+
+    for (const auto easyHandle : preemptedHandles) {
+        _queuedTransfers.push_back(stopTransfer(easyHandle));
+    }
+}
+
+void HttpAssetAccessor::startQueuedTransfers() {
+    const auto freeCount = _maxActiveTransfers - std::min(_maxActiveTransfers, uint64_t(_activeTransfers.size()));
+    const auto startCount = std::min(freeCount, uint64_t(_queuedTransfers.size()));
+
+    for (uint64_t i = 0; i < startCount; ++i) {
+        startTransfer(std::move(_queuedTransfers[i]));
+    }
+
+    _queuedTransfers.erase(_queuedTransfers.begin(), _queuedTransfers.begin() + static_cast<int64_t>(startCount));
+}
+
+void HttpAssetAccessor::startTransfer(std::unique_ptr<Transfer> transfer) {
+    const auto easyHandle = acquireEasyHandle();
+
+    // Discard anything received before the transfer was preempted
+    transfer->response = {};
+    transfer->headerList = createCurlHeaders(transfer->headers);
+
+    curl_easy_setopt(easyHandle, CURLOPT_URL, transfer->url.c_str());
+    curl_easy_setopt(easyHandle, CURLOPT_SHARE, _shareHandle);
+    curl_easy_setopt(easyHandle, CURLOPT_CAINFO, _certificatePath.c_str());
+    curl_easy_setopt(easyHandle, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(easyHandle, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(easyHandle, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(easyHandle, CURLOPT_HTTPHEADER, transfer->headerList);
+    curl_easy_setopt(easyHandle, CURLOPT_WRITEFUNCTION, writeCallback);
+    curl_easy_setopt(easyHandle, CURLOPT_WRITEDATA, &transfer->response);
+    curl_easy_setopt(easyHandle, CURLOPT_HEADERFUNCTION, headerCallback);
+    curl_easy_setopt(easyHandle, CURLOPT_HEADERDATA, &transfer->response);
+
+    // TLS 1.3 is not enabled by default.
+    curl_easy_setopt(easyHandle, CURLOPT_SSLVERSION, CURL_SSLVERSION_DEFAULT | CURL_SSLVERSION_MAX_TLSv1_3);
+
+    if (_http2Enabled) {
+        // HTTP/2 is negotiated with ALPN and falls back to HTTP/1.1. PIPEWAIT makes the transfer wait for an
+        // existing connection to the host that can be multiplexed instead of opening a new one.
+        curl_easy_setopt(easyHandle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+        curl_easy_setopt(easyHandle, CURLOPT_PIPEWAIT, 1L);
+    } else {
+        curl_easy_setopt(easyHandle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1);
+    }
+
+    if (transfer->method == "POST") {
+        curl_easy_setopt(easyHandle, CURLOPT_POST, 1L);
+        curl_easy_setopt(easyHandle, CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(transfer->payload.size()));
+        curl_easy_setopt(easyHandle, CURLOPT_POSTFIELDS, transfer->payload.data());
+    }
+
+    curl_multi_add_handle(_multiHandle, easyHandle);
+    _activeTransfers.insert({easyHandle, std::move(transfer)});
+}
+
+void HttpAssetAccessor::completeTransfers() {
+    CURLMsg* message = nullptr;
+    int messagesInQueue = 0;
+
+    while ((message = curl_multi_info_read(_multiHandle, &messagesInQueue)) != nullptr) {
+        if (message->msg != CURLMSG_DONE) {
+            continue;
+        }
+
+        // The message is invalidated by curl_multi_remove_handle so copy what's needed first
+        const auto easyHandle = message->easy_handle;
+        const auto result = message->data.result;
+
+        long statusCode = 0;
+        long httpVersion = 0;
+        long connectionsOpened = 0;
+        curl_easy_getinfo(easyHandle, CURLINFO_RESPONSE_CODE, &statusCode);
+        curl_easy_getinfo(easyHandle, CURLINFO_HTTP_VERSION, &httpVersion);
+        curl_easy_getinfo(easyHandle, CURLINFO_NUM_CONNECTS, &connectionsOpened);
+
+        {
+            std::scoped_lock<std::mutex> lock(_pendingMutex);
+            _statistics.requestsCompleted++;
+            _statistics.connectionsOpened += static_cast<uint64_t>(connectionsOpened);
+
+            if (httpVersion == CURL_HTTP_VERSION_2_0) {
+                _statistics.http2RequestsCompleted++;
+                _statistics.http2ConnectionsOpened += static_cast<uint64_t>(connectionsOpened);
+            }
+        }
+
+        if (result == CURLE_PEER_FAILED_VERIFICATION) {
+            long verifyResult;
+            curl_easy_getinfo(easyHandle, CURLINFO_SSL_VERIFYRESULT, &verifyResult);
+            CESIUM_LOG_WARN("SSL PEER VERIFICATION FAILED: {}", verifyResult);
+        }
+
+        // Shared so that the main thread task stays copyable
+        std::shared_ptr<Transfer> pTransfer = stopTransfer(easyHandle);
+
+        if (!pTransfer->coalescingKey.empty()) {
+            // Requests made from now on start a new transfer
+            std::scoped_lock<std::mutex> lock(_inFlightRequestsMutex);
+            _inFlightRequests.erase(pTransfer->coalescingKey);
+        }
+
+        const auto asyncSystem = pTransfer->asyncSystem;
+
+        static_cast<void>(asyncSystem.runInMainThread([pTransfer, result, statusCode]() {
+            // Continuations of the request, like tile content decoding, inherit its priority so that tiles that are
+            // needed for the current view are processed before ones that were only preloaded or are no longer wanted
+            ScopedTaskPriority scopedPriority(getTaskPriority(pTransfer->priorityClass));
+
+            if (result != CURLE_OK) {
+                pTransfer->promise.reject(std::runtime_error(
+                    fmt::format("Request to {} failed with error: {}", pTransfer->url, curl_easy_strerror(result))));
+            } else {
+                pTransfer->promise.resolve(TransferResult{
+                    static_cast<uint16_t>(statusCode),
+                    std::move(pTransfer->response.headers),
+                    std::move(pTransfer->response.data),
+                });
+            }
+        }));
+    }
+}
+
+std::unique_ptr<HttpAssetAccessor::Transfer> HttpAssetAccessor::stopTransfer(CURL* easyHandle) {
+    curl_multi_remove_handle(_multiHandle, easyHandle);
+
+    const auto iter = _activeTransfers.find(easyHandle);
+    auto transfer = std::move(iter->second);
+    _activeTransfers.erase(iter);
+
+    curl_slist_free_all(transfer->headerList);
+    transfer->headerList = nullptr;
+    curl_easy_reset(easyHandle);
+    _idleEasyHandles.push_back(easyHandle);
+
+    return transfer;
+}
+
+HttpStatistics HttpAssetAccessor::getStatistics() {
+    HttpStatistics statistics;
+
+    {
+        std::scoped_lock<std::mutex> lock(_pendingMutex);
+        statistics = _statistics;
+    }
+
+    {
+        std::scoped_lock<std::mutex> lock(_inFlightRequestsMutex);
+        statistics.requestsCoalesced = _requestsCoalesced;
+    }
+
+    return statistics;
+}
+
+void HttpAssetAccessor::setRequestPriorityHints(int64_t sourceId, std::vector<RequestPriorityHint>&& hints) {
+    {
+        std::scoped_lock<std::mutex> lock(_pendingMutex);
+        _pendingRequestPriorityHints.insert_or_assign(sourceId, std::move(hints));
+    }
+
+    curl_multi_wakeup(_multiHandle);
+}
+
+void HttpAssetAccessor::clearRequestPriorityHints(int64_t sourceId) {
+    {
+        std::scoped_lock<std::mutex> lock(_pendingMutex);
+        _pendingRequestPriorityHints.insert_or_assign(sourceId, std::nullopt);
+    }
+
+    curl_multi_wakeup(_multiHandle);
+}
+
+CURL* HttpAssetAccessor::acquireEasyHandle() {
+    if (_idleEasyHandles.empty()) {
+        return curl_easy_init();
+    }
+
+    const auto easyHandle = _idleEasyHandles.back();
+    _idleEasyHandles.pop_back();
+    return easyHandle;
 }
 
-void HttpAssetAccessor::tick() noexcept {}
 } // namespace cesium::omniverse
@@ -0,0 +1,159 @@
+#include "cesium/omniverse/MemoryMappedFile.h"
+
+#ifdef CESIUM_OMNI_WINDOWS
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+
+namespace cesium::omniverse {
+
+namespace {
+
+// A zero-length file can't be mapped, but it's still a valid file. Point empty mappings at this instead.
+std::byte EMPTY_MAPPING{0};
+
+} // namespace
+
+#ifdef CESIUM_OMNI_WINDOWS
+
+std::unique_ptr<MemoryMappedFile> MemoryMappedFile::open(const std::filesystem::path& path) {
+    const auto fileHandle = CreateFileW(
+        path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+        nullptr);
+
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize)) {
+        CloseHandle(fileHandle);
+        return nullptr;
+    }
+
+    const auto size = static_cast<size_t>(fileSize.QuadPart);
+
+    if (size == 0) {
+        CloseHandle(fileHandle);
+        return std::unique_ptr<MemoryMappedFile>(new MemoryMappedFile(&EMPTY_MAPPING, 0));
+    }
+
+    const auto mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    // The view keeps the file mapping alive, so neither handle is needed once the view is mapped
+    CloseHandle(fileHandle);
+
+    if (mappingHandle == nullptr) {
+        return nullptr;
+    }
+
+    const auto pMapping = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mappingHandle);
+
+    if (pMapping == nullptr) {
+        return nullptr;
+    }
+
+    return std::unique_ptr<MemoryMappedFile>(new MemoryMappedFile(pMapping, size));
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+    if (_size > 0) {
+        UnmapViewOfFile(_pMapping);
+    }
+}
+
+void MemoryMappedFile::willNeed(size_t offset, size_t size) const {
+    if (offset >= _size) {
+        return;
+    }
+
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = static_cast<std::byte*>(_pMapping) + offset;
+    range.NumberOfBytes = std::min(size, _size - offset);
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+
+#else
+
+std::unique_ptr<MemoryMappedFile> MemoryMappedFile::open(const std::filesystem::path& path) {
+    const auto fileDescriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (fileDescriptor < 0) {
+        return nullptr;
+    }
+
+    struct stat fileStat {};
+    if (fstat(fileDescriptor, &fileStat) != 0 || !S_ISREG(fileStat.st_mode)) {
+        close(fileDescriptor);
+        return nullptr;
+    }
+
+    const auto size = static_cast<size_t>(fileStat.st_size);
+
+    if (size == 0) {
+        close(fileDescriptor);
+        return std::unique_ptr<MemoryMappedFile>(new MemoryMappedFile(&EMPTY_MAPPING, 0));
+    }
+
+    const auto pMapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+    // The mapping holds its own reference to the file
+    close(fileDescriptor);
+
+    if (pMapping == MAP_FAILED) {
+        return nullptr;
+    }
+
+    // Tile content is parsed front to back
+    madvise(pMapping, size, MADV_SEQUENTIAL);
+
+    return std::unique_ptr<MemoryMappedFile>(new MemoryMappedFile(pMapping, size));
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+    if (_size > 0) {
+        munmap(_pMapping, _size);
+    }
+}
+
+void MemoryMappedFile::willNeed(size_t offset, size_t size) const {
+    if (offset >= _size) {
+        return;
+    }
+
+    // madvise needs a page-aligned address
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const auto alignedOffset = offset - offset % pageSize;
+    const auto alignedSize = std::min(size, _size - offset) + (offset - alignedOffset);
+    madvise(static_cast<std::byte*>(_pMapping) + alignedOffset, alignedSize, MADV_WILLNEED);
+}
+
+#endif
+
+MemoryMappedFile::MemoryMappedFile(void* pMapping, size_t size)
+    : _pMapping(pMapping)
+    , _size(size) {}
+
+gsl::span<const std::byte> MemoryMappedFile::getData() const {
+    return {static_cast<const std::byte*>(_pMapping), _size};
+}
+
+} // namespace cesium::omniverse
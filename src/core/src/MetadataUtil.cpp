@@ -95,10 +95,10 @@ getPropertyTextureImages(const CesiumGltf::Model& model, const CesiumGltf::MeshP
     return images;
 }
 
-std::unordered_map<uint64_t, uint64_t>
+SmallMap<uint64_t, uint64_t>
 getPropertyTextureIndexMapping(const CesiumGltf::Model& model, const CesiumGltf::MeshPrimitive& primitive) {
     std::vector<const CesiumGltf::ImageCesium*> images;
-    std::unordered_map<uint64_t, uint64_t> propertyTextureIndexMapping;
+    SmallMap<uint64_t, uint64_t> propertyTextureIndexMapping;
 
     forEachStyleablePropertyTextureProperty(
         model,
@@ -5,6 +5,7 @@
 #include "cesium/omniverse/FabricGeometry.h"
 #include "cesium/omniverse/FabricMaterial.h"
 #include "cesium/omniverse/FabricPrepareRenderResources.h"
+#include "cesium/omniverse/FabricResourceManager.h"
 #include "cesium/omniverse/FabricUtil.h"
 #include "cesium/omniverse/GeospatialUtil.h"
 #include "cesium/omniverse/HttpAssetAccessor.h"
@@ -32,6 +33,12 @@
 
 namespace cesium::omniverse {
 
+namespace {
+// Tiles go in and out of the selection as the camera moves, so a load is only cancelled once its tile has stayed
+// unwanted for this many consecutive frames
+const uint64_t UNWANTED_FRAMES_BEFORE_CANCELLING = 30;
+} // namespace
+
 OmniTileset::OmniTileset(const pxr::SdfPath& tilesetPath, const pxr::SdfPath& georeferencePath)
     : _tilesetPath(tilesetPath)
     , _tilesetId(Context::instance().getNextTilesetId()) {
@@ -42,6 +49,7 @@ OmniTileset::OmniTileset(const pxr::SdfPath& tilesetPath, const pxr::SdfPath& ge
 
 OmniTileset::~OmniTileset() {
     _renderResourcesPreparer->detachTileset();
+    Context::instance().getHttpAssetAccessor()->clearRequestPriorityHints(_tilesetId);
 }
 
 pxr::SdfPath OmniTileset::getPath() const {
@@ -245,6 +253,18 @@ bool OmniTileset::getSmoothNormals() const {
     return smoothNormals;
 }
 
+bool OmniTileset::getWeldNormals() const {
+    return _weldNormals;
+}
+
+bool OmniTileset::getRenderPointsAsCubes() const {
+    return _renderPointsAsCubes;
+}
+
+bool OmniTileset::getOptimizeMeshes() const {
+    return _optimizeMeshes;
+}
+
 bool OmniTileset::getShowCreditsOnScreen() const {
     auto tileset = UsdUtil::getCesiumTileset(_tilesetPath);
 
@@ -320,6 +340,14 @@ int64_t OmniTileset::getTilesetId() const {
     return _tilesetId;
 }
 
+std::shared_ptr<const std::atomic<bool>> OmniTileset::getPrimAliveFlag() const {
+    return _pPrimAlive;
+}
+
+void OmniTileset::setPrimRemoved() {
+    _pPrimAlive->store(false, std::memory_order_release);
+}
+
 TilesetStatistics OmniTileset::getStatistics() const {
     TilesetStatistics statistics;
 
@@ -360,11 +388,17 @@ void OmniTileset::reload() {
         _renderResourcesPreparer->detachTileset();
     }
 
+    // Read on the main thread here because tiles are prepared on worker threads, which must not read USD
+    auto tileset = UsdUtil::getCesiumTileset(_tilesetPath);
+    tileset.GetWeldNormalsAttr().Get<bool>(&_weldNormals);
+    tileset.GetRenderPointsAsCubesAttr().Get<bool>(&_renderPointsAsCubes);
+    tileset.GetOptimizeMeshesAttr().Get<bool>(&_optimizeMeshes);
+
     _renderResourcesPreparer = std::make_shared<FabricPrepareRenderResources>(*this);
     auto& context = Context::instance();
     auto asyncSystem = CesiumAsync::AsyncSystem(context.getTaskProcessor());
     const auto externals = Cesium3DTilesSelection::TilesetExternals{
-        context.getHttpAssetAccessor(),
+        context.getAssetAccessor(),
         _renderResourcesPreparer,
         std::move(asyncSystem),
         context.getCreditSystem(),
@@ -430,6 +464,7 @@ void OmniTileset::reload() {
     _extentSet = false;
     _activeLoading = false;
     _imageryPaths.clear();
+    _unwantedFrameCounts.clear();
 
     if (getSourceType() == TilesetSourceType::URL) {
         _tileset = std::make_unique<Cesium3DTilesSelection::Tileset>(externals, url, options);
@@ -445,6 +480,8 @@ void OmniTileset::reload() {
     for (const auto& imagery : UsdUtil::getChildCesiumImageryPrims(_tilesetPath)) {
         addImageryIon(imagery.GetPath());
     }
+
+    updateTilesetSnapshot();
 }
 
 void OmniTileset::addImageryIon(const pxr::SdfPath& imageryPath) {
@@ -581,7 +618,28 @@ double OmniTileset::getImageryLayerAlpha(uint64_t imageryLayerIndex) const {
     return alpha;
 }
 
+void OmniTileset::setMainThreadLoadingBudget(double budgetMilliseconds) {
+    auto timeLimit = getMainThreadLoadingTimeLimit();
+
+    // The tileset's own limit still applies when it's stricter than the budget
+    if (budgetMilliseconds > 0.0 && (timeLimit <= 0.0 || budgetMilliseconds < timeLimit)) {
+        timeLimit = budgetMilliseconds;
+    }
+
+    _tileset->getOptions().mainThreadLoadingTimeLimit = timeLimit;
+}
+
+double OmniTileset::getMainThreadLoadingTime() const {
+    return _mainThreadLoadingTime;
+}
+
+double OmniTileset::getMainThreadLoadScreenSpaceError() const {
+    return _mainThreadLoadScreenSpaceError;
+}
+
 void OmniTileset::onUpdateFrame(const std::vector<Viewport>& viewports) {
+    _mainThreadLoadingTime = 0.0;
+
     if (!UsdUtil::primExists(_tilesetPath)) {
         // TfNotice can be slow, and sometimes we get a frame or two before we actually get a chance to react on it.
         //   This guard prevents us from crashing if the prim no longer exists.
@@ -590,6 +648,10 @@ void OmniTileset::onUpdateFrame(const std::vector<Viewport>& viewports) {
 
     updateTransform();
     updateView(viewports);
+    updateLoadPriorities();
+
+    const auto mainThreadLoadingTime = _renderResourcesPreparer->takeMainThreadLoadingTime();
+    _mainThreadLoadingTime = std::chrono::duration<double, std::milli>(mainThreadLoadingTime).count();
 
     if (!_extentSet) {
         _extentSet = updateExtent();
@@ -616,9 +678,24 @@ void OmniTileset::updateTransform() {
         _ecefToUsdTransform = ecefToUsdTransform;
         FabricUtil::setTilesetTransform(_tilesetId, ecefToUsdTransform);
         updateExtent();
+        updateTilesetSnapshot();
     }
 }
 
+void OmniTileset::updateTilesetSnapshot() {
+    // Tiles are prepared on worker threads, which get everything they need from this snapshot rather than from USD
+    _renderResourcesPreparer->setTilesetSnapshot(std::make_shared<const TilesetSnapshot>(TilesetSnapshot{
+        _tilesetId,
+        _ecefToUsdTransform,
+        getMaterialPath(),
+        getImageryLayerCount(),
+        getSmoothNormals(),
+        _weldNormals,
+        _renderPointsAsCubes,
+        _optimizeMeshes,
+    }));
+}
+
 void OmniTileset::updateView(const std::vector<Viewport>& viewports) {
     const auto visible = UsdUtil::isPrimVisible(_tilesetPath);
 
@@ -702,6 +779,108 @@ bool OmniTileset::updateExtent() {
     return true;
 }
 
+double OmniTileset::computeScreenSpaceError(const Cesium3DTilesSelection::Tile& tile) const {
+    auto screenSpaceError = 0.0;
+    for (const auto& viewState : _viewStates) {
+        const auto distanceSquared = viewState.computeDistanceSquaredToBoundingVolume(tile.getBoundingVolume());
+        const auto distance = glm::sqrt(glm::max(distanceSquared, 0.0));
+        screenSpaceError =
+            glm::max(screenSpaceError, viewState.computeScreenSpaceError(tile.getGeometricError(), distance));
+    }
+
+    return screenSpaceError;
+}
+
+bool OmniTileset::hasPointContent() const {
+    auto hasPointContent = false;
+
+    _tileset->forEachLoadedTile([&hasPointContent](Cesium3DTilesSelection::Tile& tile) {
+        if (hasPointContent || tile.getState() != Cesium3DTilesSelection::TileLoadState::Done) {
+            return;
+        }
+        const auto pRenderContent = tile.getContent().getRenderContent();
+        if (!pRenderContent) {
+            return;
+        }
+        const auto pTileRenderResources = static_cast<TileRenderResources*>(pRenderContent->getRenderResources());
+        if (!pTileRenderResources) {
+            return;
+        }
+        for (const auto& fabricMesh : pTileRenderResources->fabricMeshes) {
+            if (fabricMesh.geometry && fabricMesh.geometry->getGeometryDefinition().isPoints()) {
+                hasPointContent = true;
+                return;
+            }
+        }
+    });
+
+    return hasPointContent;
+}
+
+void OmniTileset::updateLoadPriorities() {
+    _mainThreadLoadScreenSpaceError = 0.0;
+
+    if (!_pViewUpdateResult) {
+        return;
+    }
+
+    // Tiles with explicit content are identified by their content URI, which lets the asset accessor match them
+    // to in-flight requests. Tiles that were not visited this frame are no longer wanted.
+    std::vector<RequestPriorityHint> hints;
+    std::vector<LoadingTile> loadingTiles;
+    std::unordered_map<const Cesium3DTilesSelection::Tile*, uint64_t> unwantedFrameCounts;
+    const auto frameNumber = _pViewUpdateResult->frameNumber;
+    const auto pointBudgetEnabled = FabricResourceManager::getInstance().getPointBudget() > 0;
+
+    _tileset->forEachLoadedTile([this, &hints, &loadingTiles, &unwantedFrameCounts, frameNumber, pointBudgetEnabled](
+                                    Cesium3DTilesSelection::Tile& tile) {
+        const auto state = tile.getState();
+
+        // Point clouds of tiles that are closer to the camera keep more of their points
+        if (state == Cesium3DTilesSelection::TileLoadState::Done) {
+            if (pointBudgetEnabled) {
+                _renderResourcesPreparer->setTileScreenSpaceError(tile, computeScreenSpaceError(tile));
+            }
+            return;
+        }
+
+        // Tiles that are still ContentLoaded after updateView are waiting for main thread time. Only tiles in the
+        // current selection count, since tiles the camera has moved away from shouldn't pull main thread time
+        // towards their tileset.
+        if (state == Cesium3DTilesSelection::TileLoadState::ContentLoaded) {
+            if (tile.getLastSelectionState().getFrameNumber() == frameNumber) {
+                _mainThreadLoadScreenSpaceError =
+                    glm::max(_mainThreadLoadScreenSpaceError, computeScreenSpaceError(tile));
+            }
+            return;
+        }
+
+        if (state != Cesium3DTilesSelection::TileLoadState::ContentLoading) {
+            return;
+        }
+
+        const auto pContentUri = std::get_if<std::string>(&tile.getTileID());
+        if (!pContentUri) {
+            return;
+        }
+
+        const auto screenSpaceError = computeScreenSpaceError(tile);
+        const auto wanted = tile.getLastSelectionState().getFrameNumber() == frameNumber;
+        hints.push_back({*pContentUri, screenSpaceError, wanted});
+
+        const auto iter = _unwantedFrameCounts.find(&tile);
+        const auto unwantedFrameCount = wanted ? 0 : (iter == _unwantedFrameCounts.end() ? 0 : iter->second) + 1;
+        unwantedFrameCounts.emplace(&tile, unwantedFrameCount);
+        loadingTiles.push_back({&tile, *pContentUri, unwantedFrameCount >= UNWANTED_FRAMES_BEFORE_CANCELLING});
+    });
+
+    // Tiles that finished or stopped loading are forgotten
+    _unwantedFrameCounts = std::move(unwantedFrameCounts);
+
+    _renderResourcesPreparer->cancelUnwantedTileLoads(loadingTiles);
+    Context::instance().getHttpAssetAccessor()->setRequestPriorityHints(_tilesetId, std::move(hints));
+}
+
 void OmniTileset::updateLoadStatus() {
     const auto loadProgress = _tileset->computeLoadProgress();
 
@@ -0,0 +1,163 @@
+#include "cesium/omniverse/PointBudget.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace cesium::omniverse {
+
+namespace {
+
+// Even the least important point cloud keeps every MAX_STRIDE-th point so that it doesn't disappear entirely
+const uint64_t MAX_STRIDE = 1024;
+const double MIN_WEIGHT = 1e-6;
+const double MAX_WEIGHT = 1e6;
+const uint64_t SEARCH_ITERATIONS = 64;
+
+// Weights are screen space errors that change a little every time the camera moves. Small changes are ignored so
+// that strides aren't recomputed, and points rewritten, every frame.
+const double WEIGHT_CHANGE_THRESHOLD = 0.1;
+
+double clampWeight(double weight) {
+    if (std::isnan(weight)) {
+        return MIN_WEIGHT;
+    }
+
+    return std::clamp(weight, MIN_WEIGHT, MAX_WEIGHT);
+}
+
+uint64_t getStrideForFraction(double fraction) {
+    uint64_t stride = 1;
+
+    while (stride < MAX_STRIDE && fraction * static_cast<double>(stride) < 1.0) {
+        stride *= 2;
+    }
+
+    return stride;
+}
+
+uint64_t getPointsKeptAtStride(uint64_t pointCount, uint64_t stride) {
+    return (pointCount + stride - 1) / stride;
+}
+
+} // namespace
+
+void PointBudget::setBudget(uint64_t budget) {
+    if (budget != _budget) {
+        _budget = budget;
+        _dirty = true;
+    }
+}
+
+uint64_t PointBudget::getBudget() const {
+    return _budget;
+}
+
+void PointBudget::add(uint64_t id, uint64_t pointCount, double weight) {
+    _entries[id] = Entry{pointCount, clampWeight(weight), 0};
+    _dirty = true;
+}
+
+void PointBudget::remove(uint64_t id) {
+    if (_entries.erase(id) > 0) {
+        _dirty = true;
+    }
+}
+
+void PointBudget::setWeight(uint64_t id, double weight) {
+    const auto iter = _entries.find(id);
+    if (iter == _entries.end()) {
+        return;
+    }
+
+    const auto clampedWeight = clampWeight(weight);
+    auto& entry = iter->second;
+
+    if (std::abs(clampedWeight - entry.weight) > entry.weight * WEIGHT_CHANGE_THRESHOLD) {
+        entry.weight = clampedWeight;
+        _dirty = true;
+    }
+}
+
+void PointBudget::clear() {
+    _entries.clear();
+    _dirty = false;
+}
+
+std::vector<std::pair<uint64_t, uint64_t>> PointBudget::update() {
+    std::vector<std::pair<uint64_t, uint64_t>> changes;
+
+    if (!_dirty) {
+        return changes;
+    }
+
+    _dirty = false;
+
+    uint64_t totalPointCount = 0;
+    for (const auto& [id, entry] : _entries) {
+        totalPointCount += entry.pointCount;
+    }
+
+    // Each point cloud keeps min(1, scale * weight) of its points. The largest scale that fits in the budget is found
+    // by bisection. At the upper bound every point cloud keeps all of its points.
+    auto scale = 1.0 / MIN_WEIGHT;
+
+    if (_budget > 0 && totalPointCount > _budget) {
+        auto low = 0.0;
+        auto high = scale;
+
+        for (uint64_t i = 0; i < SEARCH_ITERATIONS; ++i) {
+            const auto middle = (low + high) * 0.5;
+            if (countPointsKept(middle) <= _budget) {
+                low = middle;
+            } else {
+                high = middle;
+            }
+        }
+
+        // If even the largest strides don't fit, low stays at zero and every point cloud gets the largest stride
+        scale = low;
+    }
+
+    for (auto& [id, entry] : _entries) {
+        const auto stride = getStrideForFraction(scale * entry.weight);
+        if (stride != entry.stride) {
+            entry.stride = stride;
+            changes.emplace_back(id, stride);
+        }
+    }
+
+    return changes;
+}
+
+uint64_t PointBudget::getStride(uint64_t id) const {
+    const auto iter = _entries.find(id);
+    if (iter == _entries.end()) {
+        return 0;
+    }
+
+    return iter->second.stride;
+}
+
+uint64_t PointBudget::getPointsKept() const {
+    uint64_t pointsKept = 0;
+
+    for (const auto& [id, entry] : _entries) {
+        if (entry.stride > 0) {
+            pointsKept += getPointsKeptAtStride(entry.pointCount, entry.stride);
+        }
+    }
+
+    return pointsKept;
+}
+
+uint64_t PointBudget::countPointsKept(double scale) const {
+    uint64_t pointsKept = 0;
+
+    for (const auto& [id, entry] : _entries) {
+        pointsKept += getPointsKeptAtStride(entry.pointCount, getStrideForFraction(scale * entry.weight));
+    }
+
+    return pointsKept;
+}
+
+} // namespace cesium::omniverse
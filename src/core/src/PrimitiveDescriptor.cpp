@@ -0,0 +1,51 @@
+#include "cesium/omniverse/PrimitiveDescriptor.h"
+
+#ifdef CESIUM_OMNI_MSVC
+#pragma push_macro("OPAQUE")
+#undef OPAQUE
+#endif
+
+#include <CesiumGltf/Model.h>
+
+namespace cesium::omniverse {
+
+PrimitiveDescriptor createPrimitiveDescriptor(
+    const CesiumGltf::Model& model,
+    const CesiumGltf::MeshPrimitive& primitive,
+    bool smoothNormals,
+    bool renderPointsAsCubes,
+    const pxr::SdfPath& tilesetMaterialPath) {
+    PrimitiveDescriptor descriptor;
+
+    const auto isPointCloud = primitive.mode == CesiumGltf::MeshPrimitive::Mode::POINTS;
+
+    // Smooth normals need triangles, so point clouds only have normals if the glTF provides them
+    descriptor.isPoints = isPointCloud && !renderPointsAsCubes;
+    descriptor.hasNormals = GltfUtil::hasNormals(model, primitive, smoothNormals && !isPointCloud);
+    descriptor.hasVertexColors = GltfUtil::hasVertexColors(model, primitive, 0);
+    descriptor.hasMaterial = GltfUtil::hasMaterial(primitive);
+    descriptor.texcoordSetIndexes = GltfUtil::getTexcoordSetIndexes(model, primitive);
+    descriptor.imageryTexcoordSetIndexes = GltfUtil::getImageryTexcoordSetIndexes(model, primitive);
+    descriptor.customVertexAttributes = GltfUtil::getCustomVertexAttributes(model, primitive);
+    descriptor.materialInfo = GltfUtil::getMaterialInfo(model, primitive);
+    descriptor.featuresInfo = GltfUtil::getFeaturesInfo(model, primitive);
+
+    if (tilesetMaterialPath.IsEmpty()) {
+        // Ignore properties if there's no tileset material
+        return descriptor;
+    }
+
+    descriptor.styleableProperties = MetadataUtil::getStyleableProperties(model, primitive);
+
+    if (descriptor.styleableProperties.empty()) {
+        return descriptor;
+    }
+
+    descriptor.propertyTextureImages = MetadataUtil::getPropertyTextureImages(model, primitive);
+    descriptor.propertyTextureIndexMapping = MetadataUtil::getPropertyTextureIndexMapping(model, primitive);
+    descriptor.propertyTableTextureCount = MetadataUtil::getPropertyTableTextureCount(model, primitive);
+
+    return descriptor;
+}
+
+} // namespace cesium::omniverse
@@ -0,0 +1,49 @@
+#include "cesium/omniverse/RecordingAssetAccessor.h"
+
+#include "cesium/omniverse/RequestArchive.h"
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/IAssetRequest.h>
+
+namespace cesium::omniverse {
+
+RecordingAssetAccessor::RecordingAssetAccessor(
+    const std::shared_ptr<CesiumAsync::IAssetAccessor>& assetAccessor,
+    const std::filesystem::path& archivePath)
+    : _assetAccessor(assetAccessor)
+    , _archiveWriter(std::make_shared<RequestArchiveWriter>(archivePath)) {}
+
+CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> RecordingAssetAccessor::get(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    const std::string& url,
+    const std::vector<THeader>& headers) {
+    return record(_assetAccessor->get(asyncSystem, url, headers));
+}
+
+CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> RecordingAssetAccessor::request(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    const std::string& verb,
+    const std::string& url,
+    const std::vector<THeader>& headers,
+    const gsl::span<const std::byte>& contentPayload) {
+    return record(_assetAccessor->request(asyncSystem, verb, url, headers, contentPayload));
+}
+
+void RecordingAssetAccessor::tick() noexcept {
+    _assetAccessor->tick();
+}
+
+CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+RecordingAssetAccessor::record(CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>&& future) {
+    // The archive writer is captured by value so that requests completing after the accessor is destroyed are safe
+    return std::move(future).thenImmediately(
+        [archiveWriter = _archiveWriter](std::shared_ptr<CesiumAsync::IAssetRequest>&& pRequest) {
+            if (pRequest) {
+                archiveWriter->write(*pRequest);
+            }
+
+            return std::move(pRequest);
+        });
+}
+
+} // namespace cesium::omniverse
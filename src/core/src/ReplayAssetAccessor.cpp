@@ -0,0 +1,128 @@
+#include "cesium/omniverse/ReplayAssetAccessor.h"
+
+#include "cesium/omniverse/HttpAssetAccessor.h"
+#include "cesium/omniverse/LoggerSink.h"
+#include "cesium/omniverse/RequestArchive.h"
+#include "cesium/omniverse/TaskProcessor.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace cesium::omniverse {
+
+namespace {
+
+std::string getRequestKey(const std::string& method, const std::string& url) {
+    return method + " " + url;
+}
+
+} // namespace
+
+ReplayAssetAccessor::ReplayAssetAccessor(
+    const std::filesystem::path& archivePath,
+    double latencySeconds,
+    double bandwidthBytesPerSecond)
+    : _archiveReader(std::make_shared<RequestArchiveReader>(archivePath))
+    , _latency(latencySeconds)
+    , _bandwidthBytesPerSecond(bandwidthBytesPerSecond) {
+
+    // Later entries win if the same request was recorded more than once
+    for (const auto& entry : _archiveReader->getEntries()) {
+        _entries.insert_or_assign(getRequestKey(entry.method, entry.url), &entry);
+    }
+}
+
+CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> ReplayAssetAccessor::get(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    const std::string& url,
+    const std::vector<THeader>& headers) {
+    return request(asyncSystem, "GET", url, headers, {});
+}
+
+CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>> ReplayAssetAccessor::request(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    const std::string& verb,
+    const std::string& url,
+    const std::vector<THeader>& headers,
+    [[maybe_unused]] const gsl::span<const std::byte>& contentPayload) {
+    const auto iter = _entries.find(getRequestKey(verb, url));
+
+    if (iter == _entries.end()) {
+        CESIUM_LOG_WARN("Request {} {} is not in the request archive", verb, url);
+        return asyncSystem.createResolvedFuture<std::shared_ptr<CesiumAsync::IAssetRequest>>(
+            std::make_shared<HttpAssetRequest>(
+                std::string(verb), url, headers, HttpAssetResponse(404, CesiumAsync::HttpHeaders(), {})));
+    }
+
+    const auto pEntry = iter->second;
+
+    const auto readResponse = [archiveReader = _archiveReader, pEntry, verb, url, headers]() mutable {
+        auto data = archiveReader->readData(*pEntry);
+
+        if (!data.has_value()) {
+            CESIUM_LOG_WARN("Could not read the response to {} {} from the request archive", verb, url);
+            return std::shared_ptr<CesiumAsync::IAssetRequest>(std::make_shared<HttpAssetRequest>(
+                std::move(verb), url, headers, HttpAssetResponse(404, CesiumAsync::HttpHeaders(), {})));
+        }
+
+        auto response = HttpAssetResponse(
+            pEntry->statusCode, CesiumAsync::HttpHeaders(pEntry->responseHeaders), std::move(data.value()));
+        return std::shared_ptr<CesiumAsync::IAssetRequest>(
+            std::make_shared<HttpAssetRequest>(std::move(verb), url, headers, std::move(response)));
+    };
+
+    if (_latency.count() <= 0.0 && _bandwidthBytesPerSecond <= 0.0) {
+        ScopedTaskPriority scopedPriority(TaskPriority::BLOCKING);
+        return asyncSystem.runInWorkerThread(std::move(readResponse));
+    }
+
+    // Responses share a single simulated link. Each one occupies the link for its transfer time and arrives after
+    // the latency has elapsed.
+    auto promise = asyncSystem.createPromise<void>();
+    auto future = promise.getFuture();
+
+    {
+        std::scoped_lock<std::mutex> lock(_pendingResponsesMutex);
+
+        const auto now = std::chrono::steady_clock::now();
+        const auto transferStart = std::max(now, _linkAvailableTime);
+        const auto transferDuration = std::chrono::duration<double>(
+            _bandwidthBytesPerSecond > 0.0 ? static_cast<double>(pEntry->dataSize) / _bandwidthBytesPerSecond : 0.0);
+
+        _linkAvailableTime =
+            transferStart + std::chrono::duration_cast<std::chrono::steady_clock::duration>(transferDuration);
+
+        const auto readyTime =
+            _linkAvailableTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(_latency);
+
+        _pendingResponses.push_back({readyTime, std::move(promise)});
+    }
+
+    return std::move(future).thenInWorkerThread(std::move(readResponse));
+}
+
+void ReplayAssetAccessor::tick() noexcept {
+    std::vector<PendingResponse> readyResponses;
+
+    {
+        std::scoped_lock<std::mutex> lock(_pendingResponsesMutex);
+
+        const auto now = std::chrono::steady_clock::now();
+        const auto readyBegin = std::partition(
+            _pendingResponses.begin(), _pendingResponses.end(), [now](const PendingResponse& pendingResponse) {
+                return pendingResponse.readyTime > now;
+            });
+
+        std::move(readyBegin, _pendingResponses.end(), std::back_inserter(readyResponses));
+        _pendingResponses.erase(readyBegin, _pendingResponses.end());
+    }
+
+    // Response bodies are read from disk by the continuations
+    ScopedTaskPriority scopedPriority(TaskPriority::BLOCKING);
+
+    for (const auto& readyResponse : readyResponses) {
+        readyResponse.promise.resolve();
+    }
+}
+
+} // namespace cesium::omniverse
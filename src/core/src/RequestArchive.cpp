@@ -0,0 +1,193 @@
+#include "cesium/omniverse/RequestArchive.h"
+
+#include "cesium/omniverse/LoggerSink.h"
+
+#include <CesiumAsync/IAssetRequest.h>
+#include <CesiumAsync/IAssetResponse.h>
+
+#include <array>
+#include <system_error>
+
+namespace cesium::omniverse {
+
+namespace {
+
+// Archives are a magic number followed by a sequence of records. Integers are stored in native byte order since
+// archives are meant to be replayed on the same kind of machine they were recorded on.
+const std::array<char, 8> ARCHIVE_MAGIC{'C', 'E', 'S', 'I', 'U', 'M', 'R', '1'};
+
+void writeInteger(std::ostream& stream, uint64_t value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void writeString(std::ostream& stream, const std::string& value) {
+    writeInteger(stream, value.size());
+    stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+void writeHeaders(std::ostream& stream, const CesiumAsync::HttpHeaders& headers) {
+    writeInteger(stream, headers.size());
+    for (const auto& [name, value] : headers) {
+        writeString(stream, name);
+        writeString(stream, value);
+    }
+}
+
+// Readers take the number of bytes left in the archive so that lengths read from a corrupt archive are rejected
+// before anything is allocated for them
+bool readInteger(std::istream& stream, uint64_t& remaining, uint64_t& value) {
+    if (remaining < sizeof(value)) {
+        return false;
+    }
+
+    stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+    remaining -= sizeof(value);
+
+    return static_cast<bool>(stream);
+}
+
+bool readString(std::istream& stream, uint64_t& remaining, std::string& value) {
+    uint64_t size = 0;
+
+    if (!readInteger(stream, remaining, size) || size > remaining) {
+        return false;
+    }
+
+    value.resize(size);
+    stream.read(value.data(), static_cast<std::streamsize>(size));
+    remaining -= size;
+
+    return static_cast<bool>(stream);
+}
+
+bool readHeaders(std::istream& stream, uint64_t& remaining, CesiumAsync::HttpHeaders& headers) {
+    uint64_t count = 0;
+
+    // Each header is at least the two string lengths
+    if (!readInteger(stream, remaining, count) || count > remaining / (2 * sizeof(uint64_t))) {
+        return false;
+    }
+
+    for (uint64_t i = 0; i < count; ++i) {
+        std::string name;
+        std::string value;
+
+        if (!readString(stream, remaining, name) || !readString(stream, remaining, value)) {
+            return false;
+        }
+
+        headers.insert_or_assign(std::move(name), std::move(value));
+    }
+
+    return true;
+}
+
+bool readEntry(std::istream& stream, uint64_t& remaining, ArchivedRequestEntry& entry) {
+    uint64_t statusCode = 0;
+
+    if (!readString(stream, remaining, entry.method) || !readString(stream, remaining, entry.url) ||
+        !readHeaders(stream, remaining, entry.requestHeaders) || !readInteger(stream, remaining, statusCode) ||
+        !readHeaders(stream, remaining, entry.responseHeaders) || !readInteger(stream, remaining, entry.dataSize) ||
+        entry.dataSize > remaining) {
+        return false;
+    }
+
+    entry.statusCode = static_cast<uint16_t>(statusCode);
+    entry.dataOffset = static_cast<uint64_t>(stream.tellg());
+
+    stream.seekg(static_cast<std::streamoff>(entry.dataSize), std::ios::cur);
+    remaining -= entry.dataSize;
+
+    return static_cast<bool>(stream);
+}
+
+} // namespace
+
+RequestArchiveWriter::RequestArchiveWriter(const std::filesystem::path& archivePath)
+    : _stream(archivePath, std::ios::binary | std::ios::trunc) {
+    if (!_stream) {
+        CESIUM_LOG_ERROR("Could not open request archive {} for writing", archivePath.string());
+        return;
+    }
+
+    _stream.write(ARCHIVE_MAGIC.data(), ARCHIVE_MAGIC.size());
+}
+
+void RequestArchiveWriter::write(const CesiumAsync::IAssetRequest& request) {
+    const auto pResponse = request.response();
+
+    if (!pResponse) {
+        return;
+    }
+
+    const auto data = pResponse->data();
+
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    if (!_stream) {
+        return;
+    }
+
+    writeString(_stream, request.method());
+    writeString(_stream, request.url());
+    writeHeaders(_stream, request.headers());
+    writeInteger(_stream, pResponse->statusCode());
+    writeHeaders(_stream, pResponse->headers());
+    writeInteger(_stream, data.size());
+    _stream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    _stream.flush();
+}
+
+RequestArchiveReader::RequestArchiveReader(const std::filesystem::path& archivePath)
+    : _stream(archivePath, std::ios::binary) {
+    std::error_code errorCode;
+    const auto fileSize = std::filesystem::file_size(archivePath, errorCode);
+
+    std::array<char, 8> magic{};
+    _stream.read(magic.data(), magic.size());
+
+    if (errorCode || fileSize < magic.size() || !_stream || magic != ARCHIVE_MAGIC) {
+        CESIUM_LOG_ERROR("{} is not a valid request archive", archivePath.string());
+        return;
+    }
+
+    auto remaining = static_cast<uint64_t>(fileSize - magic.size());
+
+    // Only the index is read up front. Response bodies are skipped and read on demand.
+    while (remaining > 0) {
+        ArchivedRequestEntry entry;
+
+        if (!readEntry(_stream, remaining, entry)) {
+            // A partial index could replay a different set of responses than was recorded, so nothing is loaded
+            CESIUM_LOG_ERROR("Request archive {} is truncated or corrupt", archivePath.string());
+            _entries.clear();
+            break;
+        }
+
+        _entries.emplace_back(std::move(entry));
+    }
+
+    _stream.clear();
+}
+
+const std::vector<ArchivedRequestEntry>& RequestArchiveReader::getEntries() const {
+    return _entries;
+}
+
+std::optional<std::vector<std::byte>> RequestArchiveReader::readData(const ArchivedRequestEntry& entry) {
+    std::vector<std::byte> data(entry.dataSize);
+
+    std::scoped_lock<std::mutex> lock(_mutex);
+    _stream.seekg(static_cast<std::streamoff>(entry.dataOffset));
+    _stream.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+    if (!_stream || static_cast<uint64_t>(_stream.gcount()) != data.size()) {
+        // The archive changed since it was indexed
+        _stream.clear();
+        return std::nullopt;
+    }
+
+    return data;
+}
+
+} // namespace cesium::omniverse
@@ -4,6 +4,8 @@
 #include <carb/settings/ISettings.h>
 #include <spdlog/fmt/bundled/format.h>
 
+#include <algorithm>
+
 namespace cesium::omniverse::Settings {
 
 namespace {
@@ -11,6 +13,49 @@ const size_t MAX_SESSIONS = 10;
 const char* PERSISTENT_SETTINGS_PREFIX = "/persistent";
 const char* SESSION_ION_SERVER_URL_BASE = "/exts/cesium.omniverse/sessions/session{}/ionServerUrl";
 const char* SESSION_USER_ACCESS_TOKEN_BASE = "/exts/cesium.omniverse/sessions/session{}/userAccessToken";
+const char* MAX_CACHE_ITEMS_PATH = "/persistent/exts/cesium.omniverse/maxCacheItems";
+const char* REQUESTS_PER_CACHE_PRUNE_PATH = "/persistent/exts/cesium.omniverse/requestsPerCachePrune";
+const char* MAX_CONNECTIONS_PER_HOST_PATH = "/persistent/exts/cesium.omniverse/maxConnectionsPerHost";
+const char* HTTP2_ENABLED_PATH = "/persistent/exts/cesium.omniverse/http2Enabled";
+const char* MAX_CONCURRENT_STREAMS_PATH = "/persistent/exts/cesium.omniverse/maxConcurrentStreams";
+const char* MAX_ACTIVE_REQUESTS_PATH = "/persistent/exts/cesium.omniverse/maxActiveRequests";
+const char* WORKER_THREAD_COUNT_PATH = "/persistent/exts/cesium.omniverse/workerThreadCount";
+const char* MAIN_THREAD_LOADING_BUDGET_MILLISECONDS_PATH =
+    "/persistent/exts/cesium.omniverse/mainThreadLoadingBudgetMilliseconds";
+const char* POINT_BUDGET_PATH = "/persistent/exts/cesium.omniverse/pointBudget";
+const char* REQUEST_ARCHIVE_MODE_PATH = "/exts/cesium.omniverse/requestArchiveMode";
+const char* REQUEST_ARCHIVE_PATH_PATH = "/exts/cesium.omniverse/requestArchivePath";
+const char* REPLAY_LATENCY_MILLISECONDS_PATH = "/exts/cesium.omniverse/replayLatencyMilliseconds";
+const char* REPLAY_BANDWIDTH_MEGABITS_PER_SECOND_PATH = "/exts/cesium.omniverse/replayBandwidthMegabitsPerSecond";
+const uint64_t DEFAULT_MAX_CACHE_ITEMS = 4096;
+const uint64_t DEFAULT_REQUESTS_PER_CACHE_PRUNE = 10000;
+const uint64_t DEFAULT_MAX_CONNECTIONS_PER_HOST = 6;
+const uint64_t DEFAULT_MAX_CONCURRENT_STREAMS = 100;
+const uint64_t DEFAULT_MAX_ACTIVE_REQUESTS = 64;
+
+uint64_t getPositiveIntegerSetting(const char* path, uint64_t defaultValue) {
+    auto settings = carb::getCachedInterface<carb::settings::ISettings>();
+
+    const auto value = settings->getAsInt64(path);
+
+    if (value <= 0) {
+        return defaultValue;
+    }
+
+    return static_cast<uint64_t>(value);
+}
+
+std::string getStringSetting(const char* path) {
+    auto settings = carb::getCachedInterface<carb::settings::ISettings>();
+
+    const auto value = settings->getStringBuffer(path);
+
+    if (value == nullptr) {
+        return "";
+    }
+
+    return value;
+}
 } // namespace
 
 std::string getIonServerSettingPath(const size_t index) {
@@ -115,4 +160,61 @@ void clearTokens() {
     }
 }
 
+uint64_t getMaxCacheItems() {
+    return getPositiveIntegerSetting(MAX_CACHE_ITEMS_PATH, DEFAULT_MAX_CACHE_ITEMS);
+}
+
+uint64_t getRequestsPerCachePrune() {
+    return getPositiveIntegerSetting(REQUESTS_PER_CACHE_PRUNE_PATH, DEFAULT_REQUESTS_PER_CACHE_PRUNE);
+}
+
+uint64_t getMaxConnectionsPerHost() {
+    return getPositiveIntegerSetting(MAX_CONNECTIONS_PER_HOST_PATH, DEFAULT_MAX_CONNECTIONS_PER_HOST);
+}
+
+bool getHttp2Enabled() {
+    auto settings = carb::getCachedInterface<carb::settings::ISettings>();
+    return settings->getAsBool(HTTP2_ENABLED_PATH);
+}
+
+uint64_t getMaxConcurrentStreams() {
+    return getPositiveIntegerSetting(MAX_CONCURRENT_STREAMS_PATH, DEFAULT_MAX_CONCURRENT_STREAMS);
+}
+
+uint64_t getMaxActiveRequests() {
+    return getPositiveIntegerSetting(MAX_ACTIVE_REQUESTS_PATH, DEFAULT_MAX_ACTIVE_REQUESTS);
+}
+
+std::string getRequestArchiveMode() {
+    return getStringSetting(REQUEST_ARCHIVE_MODE_PATH);
+}
+
+std::string getRequestArchivePath() {
+    return getStringSetting(REQUEST_ARCHIVE_PATH_PATH);
+}
+
+uint64_t getReplayLatencyMilliseconds() {
+    return getPositiveIntegerSetting(REPLAY_LATENCY_MILLISECONDS_PATH, 0);
+}
+
+double getReplayBandwidthMegabitsPerSecond() {
+    auto settings = carb::getCachedInterface<carb::settings::ISettings>();
+    return std::max(settings->getAsFloat64(REPLAY_BANDWIDTH_MEGABITS_PER_SECOND_PATH), 0.0);
+}
+
+uint64_t getWorkerThreadCount() {
+    // Zero picks a thread count based on the number of hardware threads
+    return getPositiveIntegerSetting(WORKER_THREAD_COUNT_PATH, 0);
+}
+
+double getMainThreadLoadingBudgetMilliseconds() {
+    auto settings = carb::getCachedInterface<carb::settings::ISettings>();
+    return std::max(settings->getAsFloat64(MAIN_THREAD_LOADING_BUDGET_MILLISECONDS_PATH), 0.0);
+}
+
+uint64_t getPointBudget() {
+    // Zero means no budget
+    return getPositiveIntegerSetting(POINT_BUDGET_PATH, 0);
+}
+
 } // namespace cesium::omniverse::Settings
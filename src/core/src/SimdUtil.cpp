@@ -0,0 +1,300 @@
+#include "cesium/omniverse/SimdUtil.h"
+
+#include <cstring>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CESIUM_OMNI_SIMD_X64
+#include <immintrin.h>
+#ifdef CESIUM_OMNI_MSVC
+#include <intrin.h>
+#endif
+#endif
+
+// GCC and Clang only allow intrinsics in functions compiled for the matching instruction set. MSVC allows them
+// anywhere, so the kernels are compiled for the baseline and only called after the CPU check.
+#if defined(CESIUM_OMNI_SIMD_X64) && !defined(CESIUM_OMNI_MSVC)
+#define CESIUM_OMNI_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define CESIUM_OMNI_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define CESIUM_OMNI_TARGET_SSE41
+#define CESIUM_OMNI_TARGET_AVX2
+#endif
+
+namespace cesium::omniverse::SimdUtil {
+
+namespace {
+
+SimdLevel detectSimdLevel() {
+#if !defined(CESIUM_OMNI_SIMD_X64)
+    return SimdLevel::NONE;
+#elif defined(CESIUM_OMNI_MSVC)
+    int info[4];
+    __cpuid(info, 0);
+    const auto maxLeaf = info[0];
+
+    __cpuid(info, 1);
+    const auto sse41 = (info[2] & (1 << 19)) != 0;
+    const auto osxsave = (info[2] & (1 << 27)) != 0;
+    const auto avx = (info[2] & (1 << 28)) != 0;
+
+    // AVX registers are only usable if the OS saves them on context switches
+    auto avx2 = false;
+    if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+        __cpuidex(info, 7, 0);
+        avx2 = (info[1] & (1 << 5)) != 0;
+    }
+
+    if (avx2) {
+        return SimdLevel::AVX2;
+    }
+
+    return sse41 ? SimdLevel::SSE41 : SimdLevel::NONE;
+#else
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX2;
+    }
+
+    return __builtin_cpu_supports("sse4.1") ? SimdLevel::SSE41 : SimdLevel::NONE;
+#endif
+}
+
+template <typename T> void convertToInt32Scalar(const T* pSource, int32_t* pTarget, uint64_t count) {
+    for (uint64_t i = 0; i < count; ++i) {
+        pTarget[i] = static_cast<int32_t>(pSource[i]);
+    }
+}
+
+void copyFlipVerticalScalar(const float* pSource, float* pTarget, uint64_t count) {
+    for (uint64_t i = 0; i < count; ++i) {
+        pTarget[i * 2] = pSource[i * 2];
+        pTarget[i * 2 + 1] = 1.0f - pSource[i * 2 + 1];
+    }
+}
+
+template <typename T>
+void normalizeColorsScalar(const T* pSource, float* pTarget, uint64_t count) {
+    constexpr auto maxValue = static_cast<float>(std::numeric_limits<T>::max());
+
+    for (uint64_t i = 0; i < count * 4; ++i) {
+        pTarget[i] = static_cast<float>(pSource[i]) / maxValue;
+    }
+}
+
+#ifdef CESIUM_OMNI_SIMD_X64
+
+CESIUM_OMNI_TARGET_SSE41 void convertUint8ToInt32Sse41(const uint8_t* pSource, int32_t* pTarget, uint64_t count) {
+    uint64_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        int32_t packed;
+        std::memcpy(&packed, pSource + i, sizeof(packed));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pTarget + i), _mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed)));
+    }
+
+    convertToInt32Scalar(pSource + i, pTarget + i, count - i);
+}
+
+CESIUM_OMNI_TARGET_AVX2 void convertUint8ToInt32Avx2(const uint8_t* pSource, int32_t* pTarget, uint64_t count) {
+    uint64_t i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        const auto source = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSource + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pTarget + i), _mm256_cvtepu8_epi32(source));
+    }
+
+    convertToInt32Scalar(pSource + i, pTarget + i, count - i);
+}
+
+CESIUM_OMNI_TARGET_SSE41 void convertUint16ToInt32Sse41(const uint16_t* pSource, int32_t* pTarget, uint64_t count) {
+    uint64_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        const auto source = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSource + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pTarget + i), _mm_cvtepu16_epi32(source));
+    }
+
+    convertToInt32Scalar(pSource + i, pTarget + i, count - i);
+}
+
+CESIUM_OMNI_TARGET_AVX2 void convertUint16ToInt32Avx2(const uint16_t* pSource, int32_t* pTarget, uint64_t count) {
+    uint64_t i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        const auto source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pTarget + i), _mm256_cvtepu16_epi32(source));
+    }
+
+    convertToInt32Scalar(pSource + i, pTarget + i, count - i);
+}
+
+CESIUM_OMNI_TARGET_SSE41 void copyFlipVerticalSse41(const float* pSource, float* pTarget, uint64_t count) {
+    const auto one = _mm_set1_ps(1.0f);
+    uint64_t i = 0;
+
+    for (; i + 2 <= count; i += 2) {
+        const auto source = _mm_loadu_ps(pSource + i * 2);
+        const auto flipped = _mm_sub_ps(one, source);
+        _mm_storeu_ps(pTarget + i * 2, _mm_blend_ps(source, flipped, 0xA));
+    }
+
+    copyFlipVerticalScalar(pSource + i * 2, pTarget + i * 2, count - i);
+}
+
+CESIUM_OMNI_TARGET_AVX2 void copyFlipVerticalAvx2(const float* pSource, float* pTarget, uint64_t count) {
+    const auto one = _mm256_set1_ps(1.0f);
+    uint64_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        const auto source = _mm256_loadu_ps(pSource + i * 2);
+        const auto flipped = _mm256_sub_ps(one, source);
+        _mm256_storeu_ps(pTarget + i * 2, _mm256_blend_ps(source, flipped, 0xAA));
+    }
+
+    copyFlipVerticalScalar(pSource + i * 2, pTarget + i * 2, count - i);
+}
+
+CESIUM_OMNI_TARGET_SSE41 void normalizeUint8ColorsSse41(const uint8_t* pSource, float* pTarget, uint64_t count) {
+    const auto maxValue = _mm_set1_ps(static_cast<float>(std::numeric_limits<uint8_t>::max()));
+
+    for (uint64_t i = 0; i < count; ++i) {
+        int32_t packed;
+        std::memcpy(&packed, pSource + i * 4, sizeof(packed));
+        const auto color = _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed))), maxValue);
+        _mm_storeu_ps(pTarget + i * 4, color);
+    }
+}
+
+CESIUM_OMNI_TARGET_AVX2 void normalizeUint8ColorsAvx2(const uint8_t* pSource, float* pTarget, uint64_t count) {
+    const auto maxValue = _mm256_set1_ps(static_cast<float>(std::numeric_limits<uint8_t>::max()));
+    uint64_t i = 0;
+
+    for (; i + 2 <= count; i += 2) {
+        const auto source = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSource + i * 4));
+        const auto colors = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(source)), maxValue);
+        _mm256_storeu_ps(pTarget + i * 4, colors);
+    }
+
+    normalizeColorsScalar(pSource + i * 4, pTarget + i * 4, count - i);
+}
+
+CESIUM_OMNI_TARGET_SSE41 void normalizeUint16ColorsSse41(const uint16_t* pSource, float* pTarget, uint64_t count) {
+    const auto maxValue = _mm_set1_ps(static_cast<float>(std::numeric_limits<uint16_t>::max()));
+
+    for (uint64_t i = 0; i < count; ++i) {
+        const auto source = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSource + i * 4));
+        const auto color = _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu16_epi32(source)), maxValue);
+        _mm_storeu_ps(pTarget + i * 4, color);
+    }
+}
+
+CESIUM_OMNI_TARGET_AVX2 void normalizeUint16ColorsAvx2(const uint16_t* pSource, float* pTarget, uint64_t count) {
+    const auto maxValue = _mm256_set1_ps(static_cast<float>(std::numeric_limits<uint16_t>::max()));
+    uint64_t i = 0;
+
+    for (; i + 2 <= count; i += 2) {
+        const auto source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + i * 4));
+        const auto colors = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(source)), maxValue);
+        _mm256_storeu_ps(pTarget + i * 4, colors);
+    }
+
+    normalizeColorsScalar(pSource + i * 4, pTarget + i * 4, count - i);
+}
+
+#endif
+
+} // namespace
+
+SimdLevel getSimdLevel() {
+    static const auto simdLevel = detectSimdLevel();
+    return simdLevel;
+}
+
+void convertUint8ToInt32(const uint8_t* pSource, int32_t* pTarget, uint64_t count) {
+#ifdef CESIUM_OMNI_SIMD_X64
+    switch (getSimdLevel()) {
+        case SimdLevel::AVX2:
+            convertUint8ToInt32Avx2(pSource, pTarget, count);
+            return;
+        case SimdLevel::SSE41:
+            convertUint8ToInt32Sse41(pSource, pTarget, count);
+            return;
+        case SimdLevel::NONE:
+            break;
+    }
+#endif
+
+    convertToInt32Scalar(pSource, pTarget, count);
+}
+
+void convertUint16ToInt32(const uint16_t* pSource, int32_t* pTarget, uint64_t count) {
+#ifdef CESIUM_OMNI_SIMD_X64
+    switch (getSimdLevel()) {
+        case SimdLevel::AVX2:
+            convertUint16ToInt32Avx2(pSource, pTarget, count);
+            return;
+        case SimdLevel::SSE41:
+            convertUint16ToInt32Sse41(pSource, pTarget, count);
+            return;
+        case SimdLevel::NONE:
+            break;
+    }
+#endif
+
+    convertToInt32Scalar(pSource, pTarget, count);
+}
+
+void copyFlipVertical(const float* pSource, float* pTarget, uint64_t count) {
+#ifdef CESIUM_OMNI_SIMD_X64
+    switch (getSimdLevel()) {
+        case SimdLevel::AVX2:
+            copyFlipVerticalAvx2(pSource, pTarget, count);
+            return;
+        case SimdLevel::SSE41:
+            copyFlipVerticalSse41(pSource, pTarget, count);
+            return;
+        case SimdLevel::NONE:
+            break;
+    }
+#endif
+
+    copyFlipVerticalScalar(pSource, pTarget, count);
+}
+
+void normalizeUint8Colors(const uint8_t* pSource, float* pTarget, uint64_t count) {
+#ifdef CESIUM_OMNI_SIMD_X64
+    switch (getSimdLevel()) {
+        case SimdLevel::AVX2:
+            normalizeUint8ColorsAvx2(pSource, pTarget, count);
+            return;
+        case SimdLevel::SSE41:
+            normalizeUint8ColorsSse41(pSource, pTarget, count);
+            return;
+        case SimdLevel::NONE:
+            break;
+    }
+#endif
+
+    normalizeColorsScalar(pSource, pTarget, count);
+}
+
+void normalizeUint16Colors(const uint16_t* pSource, float* pTarget, uint64_t count) {
+#ifdef CESIUM_OMNI_SIMD_X64
+    switch (getSimdLevel()) {
+        case SimdLevel::AVX2:
+            normalizeUint16ColorsAvx2(pSource, pTarget, count);
+            return;
+        case SimdLevel::SSE41:
+            normalizeUint16ColorsSse41(pSource, pTarget, count);
+            return;
+        case SimdLevel::NONE:
+            break;
+    }
+#endif
+
+    normalizeColorsScalar(pSource, pTarget, count);
+}
+
+} // namespace cesium::omniverse::SimdUtil
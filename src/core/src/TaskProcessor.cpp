@@ -1,7 +1,306 @@
 #include "cesium/omniverse/TaskProcessor.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace cesium::omniverse {
+
+namespace {
+
+const size_t BLOCKING_THREAD_COUNT = 4;
+
+thread_local TaskPriority currentTaskPriority = TaskPriority::NORMAL;
+thread_local TaskProcessor* pCurrentTaskProcessor = nullptr;
+thread_local size_t currentWorkerIndex = 0;
+
+size_t getHistogramBucket(std::chrono::steady_clock::duration duration) {
+    const auto microseconds = static_cast<uint64_t>(
+        std::max<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count(), 0));
+
+    size_t bucket = 0;
+    for (auto value = microseconds; value > 0 && bucket < TASK_HISTOGRAM_BUCKET_COUNT - 1; value >>= 1) {
+        bucket++;
+    }
+
+    return bucket;
+}
+
+} // namespace
+
+uint64_t getTaskHistogramPercentile(const TaskHistogram& histogram, double percentile) {
+    uint64_t total = 0;
+    for (const auto count : histogram) {
+        total += count;
+    }
+
+    if (total == 0) {
+        return 0;
+    }
+
+    const auto target = std::max(
+        static_cast<uint64_t>(std::ceil(std::clamp(percentile, 0.0, 1.0) * static_cast<double>(total))), uint64_t(1));
+
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < histogram.size(); ++i) {
+        cumulative += histogram[i];
+
+        if (cumulative >= target) {
+            return uint64_t(1) << i;
+        }
+    }
+
+    return uint64_t(1) << (histogram.size() - 1);
+}
+
+ScopedTaskPriority::ScopedTaskPriority(TaskPriority priority)
+    : _previousPriority(currentTaskPriority) {
+    currentTaskPriority = priority;
+}
+
+ScopedTaskPriority::~ScopedTaskPriority() {
+    currentTaskPriority = _previousPriority;
+}
+
+TaskProcessor::TaskProcessor(uint64_t workerThreadCount) {
+    if (workerThreadCount == 0) {
+        const auto hardwareThreadCount = static_cast<uint64_t>(std::thread::hardware_concurrency());
+        workerThreadCount = std::max(hardwareThreadCount, uint64_t(2)) - 1;
+    }
+
+    _workerQueues.reserve(workerThreadCount);
+    for (uint64_t i = 0; i < workerThreadCount; ++i) {
+        _workerQueues.push_back(std::make_unique<TaskQueue>());
+    }
+
+    // Queues must all exist before any worker starts stealing from them
+    _workerThreads.reserve(workerThreadCount);
+    for (size_t i = 0; i < workerThreadCount; ++i) {
+        _workerThreads.emplace_back([this, i]() { runWorker(i); });
+    }
+
+    _blockingThreads.reserve(BLOCKING_THREAD_COUNT);
+    for (size_t i = 0; i < BLOCKING_THREAD_COUNT; ++i) {
+        _blockingThreads.emplace_back([this]() { runBlockingWorker(); });
+    }
+}
+
+TaskProcessor::~TaskProcessor() {
+    // Queued tasks still run before the threads exit since promises would otherwise never be resolved
+    {
+        std::scoped_lock<std::mutex, std::mutex> lock(_wakeMutex, _blockingMutex);
+        _stopping = true;
+    }
+
+    _wakeCondition.notify_all();
+    _blockingCondition.notify_all();
+
+    for (auto& thread : _workerThreads) {
+        thread.join();
+    }
+
+    for (auto& thread : _blockingThreads) {
+        thread.join();
+    }
+}
+
 void TaskProcessor::startTask(std::function<void()> f) {
-    _dispatcher.Run(f);
+    auto task = Task{std::move(f), currentTaskPriority, std::chrono::steady_clock::now()};
+
+    _tasksQueued++;
+
+    if (task.priority == TaskPriority::BLOCKING) {
+        {
+            std::scoped_lock<std::mutex> lock(_blockingMutex);
+            _blockingTasks.push_back(std::move(task));
+        }
+
+        _blockingCondition.notify_one();
+        return;
+    }
+
+    const auto priorityIndex = static_cast<size_t>(task.priority);
+    auto& queue = pCurrentTaskProcessor == this ? *_workerQueues[currentWorkerIndex] : _sharedQueue;
+
+    {
+        std::scoped_lock<std::mutex> lock(queue.mutex);
+        queue.tasks[priorityIndex].push_back(std::move(task));
+    }
+
+    // The count is only incremented once the task can be found so that a woken worker never misses it
+    {
+        std::scoped_lock<std::mutex> lock(_wakeMutex);
+        _queuedTaskCount++;
+    }
+
+    _wakeCondition.notify_one();
+}
+
+uint64_t TaskProcessor::getWorkerThreadCount() const {
+    return _workerThreads.size();
+}
+
+TaskStatistics TaskProcessor::getStatistics() const {
+    TaskStatistics statistics;
+    statistics.tasksQueued = _tasksQueued;
+    statistics.tasksRunning = _tasksRunning;
+    statistics.tasksCompleted = _tasksCompleted;
+
+    for (size_t i = 0; i < TASK_HISTOGRAM_BUCKET_COUNT; ++i) {
+        statistics.waitTimeHistogram[i] = _waitTimeHistogram[i].load(std::memory_order_relaxed);
+        statistics.runTimeHistogram[i] = _runTimeHistogram[i].load(std::memory_order_relaxed);
+    }
+
+    return statistics;
 }
+
+void TaskProcessor::runWorker(size_t workerIndex) {
+    pCurrentTaskProcessor = this;
+    currentWorkerIndex = workerIndex;
+
+    Task task;
+
+    while (true) {
+        if (tryPopTask(workerIndex, task)) {
+            runTask(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(_wakeMutex);
+        _wakeCondition.wait(lock, [this]() { return _queuedTaskCount > 0 || _stopping; });
+
+        if (_stopping && _queuedTaskCount == 0) {
+            return;
+        }
+    }
+}
+
+void TaskProcessor::runBlockingWorker() {
+    while (true) {
+        Task task;
+
+        {
+            std::unique_lock<std::mutex> lock(_blockingMutex);
+            _blockingCondition.wait(lock, [this]() { return !_blockingTasks.empty() || _stopping; });
+
+            if (_blockingTasks.empty()) {
+                return;
+            }
+
+            task = std::move(_blockingTasks.front());
+            _blockingTasks.pop_front();
+        }
+
+        runTask(task);
+    }
+}
+
+bool TaskProcessor::tryPopTask(size_t workerIndex, Task& task) {
+    const auto workerCount = _workerQueues.size();
+
+    // Own tasks are taken newest first so that a chain of continuations finishes while its data is still in cache.
+    // Shared and stolen tasks are taken oldest first.
+    const auto popBack = [&task](TaskQueue& queue, size_t priorityIndex) {
+        std::scoped_lock<std::mutex> lock(queue.mutex);
+        auto& tasks = queue.tasks[priorityIndex];
+        if (tasks.empty()) {
+            return false;
+        }
+        task = std::move(tasks.back());
+        tasks.pop_back();
+        return true;
+    };
+
+    const auto popFront = [&task](TaskQueue& queue, size_t priorityIndex) {
+        std::scoped_lock<std::mutex> lock(queue.mutex);
+        auto& tasks = queue.tasks[priorityIndex];
+        if (tasks.empty()) {
+            return false;
+        }
+        task = std::move(tasks.front());
+        tasks.pop_front();
+        return true;
+    };
+
+    for (size_t priorityIndex = 0; priorityIndex < PRIORITY_COUNT; ++priorityIndex) {
+        auto found = popBack(*_workerQueues[workerIndex], priorityIndex) || popFront(_sharedQueue, priorityIndex);
+
+        for (size_t i = 1; !found && i < workerCount; ++i) {
+            found = popFront(*_workerQueues[(workerIndex + i) % workerCount], priorityIndex);
+        }
+
+        if (found) {
+            std::scoped_lock<std::mutex> lock(_wakeMutex);
+            _queuedTaskCount--;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void TaskProcessor::runTask(Task& task) {
+    ScopedTaskPriority scopedPriority(
+        task.priority == TaskPriority::BLOCKING ? TaskPriority::NORMAL : task.priority);
+
+    const auto runStartTime = std::chrono::steady_clock::now();
+    _waitTimeHistogram[getHistogramBucket(runStartTime - task.startTime)].fetch_add(1, std::memory_order_relaxed);
+    _tasksQueued--;
+    _tasksRunning++;
+
+    task.function();
+    task.function = nullptr;
+
+    _runTimeHistogram[getHistogramBucket(std::chrono::steady_clock::now() - runStartTime)].fetch_add(
+        1, std::memory_order_relaxed);
+    _tasksRunning--;
+    _tasksCompleted++;
+}
+
+uint64_t getParallelLaneCount() {
+    return pCurrentTaskProcessor != nullptr ? std::max(pCurrentTaskProcessor->getWorkerThreadCount(), uint64_t(1)) : 1;
+}
+
+void runParallel(uint64_t laneCount, const std::function<void(uint64_t laneIndex)>& f) {
+    if (laneCount <= 1 || pCurrentTaskProcessor == nullptr) {
+        for (uint64_t i = 0; i < laneCount; ++i) {
+            f(i);
+        }
+        return;
+    }
+
+    struct LaneState {
+        std::atomic<uint64_t> nextLane{0};
+        std::mutex mutex;
+        std::condition_variable condition;
+        uint64_t finishedLaneCount{0};
+    };
+
+    // A helper task can start after every lane is claimed and this function has returned, so helpers share ownership
+    // of the state and only touch f once they have claimed a lane
+    const auto pState = std::make_shared<LaneState>();
+
+    const auto runLanes = [laneCount](LaneState& state, const std::function<void(uint64_t)>& laneFunction) {
+        for (auto lane = state.nextLane++; lane < laneCount; lane = state.nextLane++) {
+            laneFunction(lane);
+
+            {
+                std::scoped_lock<std::mutex> lock(state.mutex);
+                state.finishedLaneCount++;
+            }
+
+            state.condition.notify_all();
+        }
+    };
+
+    const auto pFunction = &f;
+    for (uint64_t i = 1; i < laneCount; ++i) {
+        pCurrentTaskProcessor->startTask([pState, pFunction, runLanes]() { runLanes(*pState, *pFunction); });
+    }
+
+    runLanes(*pState, f);
+
+    std::unique_lock<std::mutex> lock(pState->mutex);
+    pState->condition.wait(lock, [&pState, laneCount]() { return pState->finishedLaneCount == laneCount; });
+}
+
 } // namespace cesium::omniverse
@@ -0,0 +1,108 @@
+#include "cesium/omniverse/UriUtil.h"
+
+namespace cesium::omniverse::UriUtil {
+
+namespace {
+
+int getHexDigitValue(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+
+    return -1;
+}
+
+} // namespace
+
+std::optional<std::filesystem::path> getLocalPath(const std::string& uri, std::string_view scheme) {
+    if (uri.compare(0, scheme.size(), scheme) != 0) {
+        return std::nullopt;
+    }
+
+    auto path = std::string_view(uri).substr(scheme.size());
+    path = path.substr(0, path.find_first_of("?#"));
+
+    // Only local files are handled here. file://localhost/path is equivalent to file:///path.
+    const auto pathStart = path.find('/');
+    const auto host = path.substr(0, pathStart);
+    if (pathStart == std::string_view::npos || (!host.empty() && host != "localhost")) {
+        return std::nullopt;
+    }
+
+    path = path.substr(pathStart);
+
+    std::string decodedPath;
+    decodedPath.reserve(path.size());
+
+    for (size_t i = 0; i < path.size(); ++i) {
+        if (path[i] == '%' && i + 2 < path.size()) {
+            const auto high = getHexDigitValue(path[i + 1]);
+            const auto low = getHexDigitValue(path[i + 2]);
+
+            if (high >= 0 && low >= 0) {
+                decodedPath.push_back(static_cast<char>(high * 16 + low));
+                i += 2;
+                continue;
+            }
+        }
+
+        decodedPath.push_back(path[i]);
+    }
+
+#ifdef CESIUM_OMNI_WINDOWS
+    // file:///C:/path becomes C:/path
+    if (decodedPath.size() >= 3 && decodedPath[0] == '/' && decodedPath[2] == ':') {
+        decodedPath.erase(0, 1);
+    }
+#endif
+
+    return std::filesystem::u8path(decodedPath);
+}
+
+std::string_view getUrlPath(std::string_view url) {
+    return url.substr(0, url.find_first_of("?#"));
+}
+
+std::string_view normalizeUrlSuffix(std::string_view suffix) {
+    suffix = getUrlPath(suffix);
+
+    // Relative content URIs may start with ./ or ../ segments that don't appear in the resolved URL
+    while (true) {
+        if (suffix.rfind("./", 0) == 0) {
+            suffix.remove_prefix(2);
+        } else if (suffix.rfind("../", 0) == 0) {
+            suffix.remove_prefix(3);
+        } else if (suffix.rfind('/', 0) == 0) {
+            suffix.remove_prefix(1);
+        } else {
+            return suffix;
+        }
+    }
+}
+
+std::string_view getFileName(std::string_view path) {
+    const auto slash = path.rfind('/');
+    return slash == std::string_view::npos ? path : path.substr(slash + 1);
+}
+
+bool endsWithPathSuffix(std::string_view path, std::string_view suffix) {
+    if (suffix.empty() || path.size() < suffix.size()) {
+        return false;
+    }
+
+    if (path.compare(path.size() - suffix.size(), suffix.size(), suffix) != 0) {
+        return false;
+    }
+
+    return path.size() == suffix.size() || path[path.size() - suffix.size() - 1] == '/';
+}
+
+} // namespace cesium::omniverse::UriUtil
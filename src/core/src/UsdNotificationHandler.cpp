@@ -160,6 +160,8 @@ void UsdNotificationHandler::onPrimRemoved(const pxr::SdfPath& primPath) {
         const auto type = getType(tilesetPath);
         if (type == ChangedPrimType::CESIUM_TILESET) {
             if (inSubtree(primPath, tilesetPath)) {
+                // Loads in flight check this flag, so clear it now rather than when the change is processed
+                tileset->setPrimRemoved();
                 _changedPrims.emplace_back(ChangedPrim{tilesetPath, pxr::TfToken(), type, ChangeType::PRIM_REMOVED});
                 CESIUM_LOG_INFO("Removed prim: {}", tilesetPath.GetText());
             }
@@ -0,0 +1,325 @@
+#include "cesium/omniverse/ZipArchive.h"
+
+#include "cesium/omniverse/MemoryMappedFile.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace cesium::omniverse {
+
+namespace {
+
+const uint32_t LOCAL_FILE_HEADER_SIGNATURE = 0x04034b50;
+const uint32_t CENTRAL_DIRECTORY_HEADER_SIGNATURE = 0x02014b50;
+const uint32_t END_OF_CENTRAL_DIRECTORY_SIGNATURE = 0x06054b50;
+const uint32_t ZIP64_END_OF_CENTRAL_DIRECTORY_SIGNATURE = 0x06064b50;
+const uint32_t ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIGNATURE = 0x07064b50;
+const uint16_t ZIP64_EXTENDED_INFORMATION_ID = 0x0001;
+
+const size_t LOCAL_FILE_HEADER_SIZE = 30;
+const size_t CENTRAL_DIRECTORY_HEADER_SIZE = 46;
+const size_t END_OF_CENTRAL_DIRECTORY_SIZE = 22;
+const size_t ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE = 56;
+const size_t ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE = 20;
+const size_t MAX_COMMENT_SIZE = 0xffff;
+
+const uint16_t COMPRESSION_METHOD_STORED = 0;
+const uint16_t COMPRESSION_METHOD_DEFLATED = 8;
+const uint16_t FLAG_ENCRYPTED = 0x1;
+
+// Deflate can't expand data by more than about 1032:1, since a match of at most 258 bytes takes at least two bits.
+// Uncompressed sizes beyond that are corrupt and aren't allocated.
+const uint64_t MAX_DEFLATE_RATIO = 1032;
+
+// Zip fields are little endian and unaligned
+template <typename T> T readLittleEndian(gsl::span<const std::byte> data, size_t offset) {
+    T value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        value |= static_cast<T>(static_cast<T>(data[offset + i]) << (8 * i));
+    }
+    return value;
+}
+
+bool inRange(gsl::span<const std::byte> data, uint64_t offset, uint64_t size) {
+    return offset <= data.size() && size <= data.size() - offset;
+}
+
+std::optional<size_t> findEndOfCentralDirectory(gsl::span<const std::byte> data) {
+    if (data.size() < END_OF_CENTRAL_DIRECTORY_SIZE) {
+        return std::nullopt;
+    }
+
+    // The record is at the very end of the file unless the archive has a comment
+    const auto last = data.size() - END_OF_CENTRAL_DIRECTORY_SIZE;
+    const auto first = last - std::min(last, MAX_COMMENT_SIZE);
+
+    for (auto offset = last + 1; offset-- > first;) {
+        if (readLittleEndian<uint32_t>(data, offset) == END_OF_CENTRAL_DIRECTORY_SIGNATURE) {
+            return offset;
+        }
+    }
+
+    return std::nullopt;
+}
+
+struct CentralDirectoryLocation {
+    uint64_t entryCount;
+    uint64_t offset;
+    uint64_t size;
+};
+
+std::optional<CentralDirectoryLocation> findCentralDirectory(gsl::span<const std::byte> data) {
+    const auto eocdOffset = findEndOfCentralDirectory(data);
+
+    if (!eocdOffset.has_value()) {
+        return std::nullopt;
+    }
+
+    CentralDirectoryLocation location{
+        readLittleEndian<uint16_t>(data, eocdOffset.value() + 10),
+        readLittleEndian<uint32_t>(data, eocdOffset.value() + 16),
+        readLittleEndian<uint32_t>(data, eocdOffset.value() + 12),
+    };
+
+    // ZIP64 archives have a locator immediately before the regular record that points at the ZIP64 record
+    if (eocdOffset.value() >= ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE) {
+        const auto locatorOffset = eocdOffset.value() - ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE;
+
+        if (readLittleEndian<uint32_t>(data, locatorOffset) == ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIGNATURE) {
+            const auto zip64Offset = readLittleEndian<uint64_t>(data, locatorOffset + 8);
+
+            if (!inRange(data, zip64Offset, ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE) ||
+                readLittleEndian<uint32_t>(data, zip64Offset) != ZIP64_END_OF_CENTRAL_DIRECTORY_SIGNATURE) {
+                return std::nullopt;
+            }
+
+            location.entryCount = readLittleEndian<uint64_t>(data, zip64Offset + 32);
+            location.size = readLittleEndian<uint64_t>(data, zip64Offset + 40);
+            location.offset = readLittleEndian<uint64_t>(data, zip64Offset + 48);
+        }
+    }
+
+    if (!inRange(data, location.offset, location.size)) {
+        return std::nullopt;
+    }
+
+    return location;
+}
+
+} // namespace
+
+std::shared_ptr<ZipArchive> ZipArchive::open(const std::filesystem::path& path) {
+    auto pFile = MemoryMappedFile::open(path);
+
+    if (!pFile) {
+        return nullptr;
+    }
+
+    const auto data = pFile->getData();
+    const auto centralDirectory = findCentralDirectory(data);
+
+    if (!centralDirectory.has_value()) {
+        return nullptr;
+    }
+
+    // The central directory is read once, front to back
+    pFile->willNeed(centralDirectory->offset, centralDirectory->size);
+
+    // Every entry needs at least a fixed size header, so the entry count can't be larger than the directory allows
+    if (centralDirectory->entryCount > centralDirectory->size / CENTRAL_DIRECTORY_HEADER_SIZE) {
+        return nullptr;
+    }
+
+    std::unordered_map<std::string, Entry> entries;
+    entries.reserve(centralDirectory->entryCount);
+
+    const auto directoryEnd = centralDirectory->offset + centralDirectory->size;
+    auto offset = centralDirectory->offset;
+
+    for (uint64_t i = 0; i < centralDirectory->entryCount; ++i) {
+        if (offset + CENTRAL_DIRECTORY_HEADER_SIZE > directoryEnd ||
+            readLittleEndian<uint32_t>(data, offset) != CENTRAL_DIRECTORY_HEADER_SIGNATURE) {
+            return nullptr;
+        }
+
+        const auto flags = readLittleEndian<uint16_t>(data, offset + 8);
+        const auto compressionMethod = readLittleEndian<uint16_t>(data, offset + 10);
+        uint64_t compressedSize = readLittleEndian<uint32_t>(data, offset + 20);
+        uint64_t uncompressedSize = readLittleEndian<uint32_t>(data, offset + 24);
+        const auto nameSize = readLittleEndian<uint16_t>(data, offset + 28);
+        const auto extraSize = readLittleEndian<uint16_t>(data, offset + 30);
+        const auto commentSize = readLittleEndian<uint16_t>(data, offset + 32);
+        uint64_t localHeaderOffset = readLittleEndian<uint32_t>(data, offset + 42);
+
+        const auto nameOffset = offset + CENTRAL_DIRECTORY_HEADER_SIZE;
+        const auto extraOffset = nameOffset + nameSize;
+        const auto nextOffset = extraOffset + extraSize + commentSize;
+
+        if (nextOffset > directoryEnd) {
+            return nullptr;
+        }
+
+        // Values that don't fit in 32 bits are saturated and moved to the ZIP64 extra field, in this order
+        auto extraFieldOffset = extraOffset;
+        while (extraFieldOffset + 4 <= extraOffset + extraSize) {
+            const auto fieldId = readLittleEndian<uint16_t>(data, extraFieldOffset);
+            const auto fieldSize = readLittleEndian<uint16_t>(data, extraFieldOffset + 2);
+            const auto fieldEnd = extraFieldOffset + 4 + fieldSize;
+
+            if (fieldEnd > extraOffset + extraSize) {
+                break;
+            }
+
+            if (fieldId == ZIP64_EXTENDED_INFORMATION_ID) {
+                auto valueOffset = extraFieldOffset + 4;
+
+                for (auto pValue : {&uncompressedSize, &compressedSize, &localHeaderOffset}) {
+                    if (*pValue == std::numeric_limits<uint32_t>::max() && valueOffset + 8 <= fieldEnd) {
+                        *pValue = readLittleEndian<uint64_t>(data, valueOffset);
+                        valueOffset += 8;
+                    }
+                }
+            }
+
+            extraFieldOffset = fieldEnd;
+        }
+
+        const auto name = std::string(reinterpret_cast<const char*>(data.data() + nameOffset), nameSize);
+        const auto isDirectory = !name.empty() && name.back() == '/';
+        const auto isEncrypted = (flags & FLAG_ENCRYPTED) != 0;
+
+        if (!isDirectory && !isEncrypted) {
+            entries.insert_or_assign(
+                name, Entry{compressionMethod, compressedSize, uncompressedSize, localHeaderOffset});
+        }
+
+        offset = nextOffset;
+    }
+
+    return std::shared_ptr<ZipArchive>(new ZipArchive(std::move(pFile), std::move(entries)));
+}
+
+ZipArchive::ZipArchive(std::unique_ptr<MemoryMappedFile>&& pFile, std::unordered_map<std::string, Entry>&& entries)
+    : _pFile(std::move(pFile))
+    , _entries(std::move(entries)) {}
+
+ZipArchive::~ZipArchive() = default;
+
+bool ZipArchive::contains(const std::string& entryName) const {
+    return _entries.find(entryName) != _entries.end();
+}
+
+size_t ZipArchive::getEntryCount() const {
+    return _entries.size();
+}
+
+std::optional<gsl::span<const std::byte>> ZipArchive::getStoredEntry(const std::string& entryName) const {
+    const auto iter = _entries.find(entryName);
+
+    if (iter == _entries.end() || iter->second.compressionMethod != COMPRESSION_METHOD_STORED ||
+        iter->second.compressedSize != iter->second.uncompressedSize) {
+        return std::nullopt;
+    }
+
+    return getCompressedData(iter->second);
+}
+
+std::optional<std::vector<std::byte>> ZipArchive::readEntry(const std::string& entryName) const {
+    const auto iter = _entries.find(entryName);
+
+    if (iter == _entries.end()) {
+        return std::nullopt;
+    }
+
+    const auto& entry = iter->second;
+    const auto compressedData = getCompressedData(entry);
+
+    if (!compressedData.has_value()) {
+        return std::nullopt;
+    }
+
+    if (entry.compressionMethod == COMPRESSION_METHOD_STORED) {
+        if (compressedData->size() != entry.uncompressedSize) {
+            return std::nullopt;
+        }
+
+        return std::vector<std::byte>(compressedData->begin(), compressedData->end());
+    }
+
+    if (entry.compressionMethod != COMPRESSION_METHOD_DEFLATED ||
+        entry.uncompressedSize / MAX_DEFLATE_RATIO > compressedData->size()) {
+        return std::nullopt;
+    }
+
+    if (entry.uncompressedSize == 0) {
+        return std::vector<std::byte>();
+    }
+
+    // The uncompressed size is known up front so the entry is inflated into a single buffer
+    std::vector<std::byte> uncompressedData(entry.uncompressedSize);
+
+    z_stream stream{};
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+        return std::nullopt;
+    }
+
+    const auto maxChunkSize = static_cast<uint64_t>(std::numeric_limits<uInt>::max());
+    auto pInput = reinterpret_cast<const Bytef*>(compressedData->data());
+    uint64_t inputRemaining = compressedData->size();
+    uint64_t outputRemaining = uncompressedData.size();
+    stream.next_out = reinterpret_cast<Bytef*>(uncompressedData.data());
+
+    auto result = Z_OK;
+    while (result == Z_OK) {
+        // avail_in and avail_out are 32-bit, so very large entries are fed through in chunks
+        if (stream.avail_in == 0 && inputRemaining > 0) {
+            stream.next_in = const_cast<Bytef*>(pInput);
+            stream.avail_in = static_cast<uInt>(std::min(inputRemaining, maxChunkSize));
+            pInput += stream.avail_in;
+            inputRemaining -= stream.avail_in;
+        }
+
+        if (stream.avail_out == 0 && outputRemaining > 0) {
+            stream.avail_out = static_cast<uInt>(std::min(outputRemaining, maxChunkSize));
+            outputRemaining -= stream.avail_out;
+        }
+
+        result = inflate(&stream, Z_NO_FLUSH);
+    }
+
+    // total_out is only 32 bits on some platforms, so the output size comes from the output pointer instead
+    const auto totalOut =
+        static_cast<uint64_t>(stream.next_out - reinterpret_cast<const Bytef*>(uncompressedData.data()));
+    inflateEnd(&stream);
+
+    // Streams that end early, or that would run past the declared size, are corrupt
+    if (result != Z_STREAM_END || totalOut != entry.uncompressedSize) {
+        return std::nullopt;
+    }
+
+    return uncompressedData;
+}
+
+std::optional<gsl::span<const std::byte>> ZipArchive::getCompressedData(const Entry& entry) const {
+    const auto data = _pFile->getData();
+
+    if (!inRange(data, entry.localHeaderOffset, LOCAL_FILE_HEADER_SIZE) ||
+        readLittleEndian<uint32_t>(data, entry.localHeaderOffset) != LOCAL_FILE_HEADER_SIGNATURE) {
+        return std::nullopt;
+    }
+
+    // The local header's name and extra field lengths can differ from the central directory's
+    const auto nameSize = readLittleEndian<uint16_t>(data, entry.localHeaderOffset + 26);
+    const auto extraSize = readLittleEndian<uint16_t>(data, entry.localHeaderOffset + 28);
+    const auto dataOffset = entry.localHeaderOffset + LOCAL_FILE_HEADER_SIZE + nameSize + extraSize;
+
+    if (!inRange(data, dataOffset, entry.compressedSize)) {
+        return std::nullopt;
+    }
+
+    return data.subspan(dataOffset, entry.compressedSize);
+}
+
+} // namespace cesium::omniverse
@@ -369,6 +369,57 @@ CesiumTileset::CreateSmoothNormalsAttr(VtValue const &defaultValue, bool writeSp
                        writeSparsely);
 }
 
+UsdAttribute
+CesiumTileset::GetWeldNormalsAttr() const
+{
+    return GetPrim().GetAttribute(CesiumTokens->cesiumWeldNormals);
+}
+
+UsdAttribute
+CesiumTileset::CreateWeldNormalsAttr(VtValue const &defaultValue, bool writeSparsely) const
+{
+    return UsdSchemaBase::_CreateAttr(CesiumTokens->cesiumWeldNormals,
+                       SdfValueTypeNames->Bool,
+                       /* custom = */ false,
+                       SdfVariabilityVarying,
+                       defaultValue,
+                       writeSparsely);
+}
+
+UsdAttribute
+CesiumTileset::GetRenderPointsAsCubesAttr() const
+{
+    return GetPrim().GetAttribute(CesiumTokens->cesiumRenderPointsAsCubes);
+}
+
+UsdAttribute
+CesiumTileset::CreateRenderPointsAsCubesAttr(VtValue const &defaultValue, bool writeSparsely) const
+{
+    return UsdSchemaBase::_CreateAttr(CesiumTokens->cesiumRenderPointsAsCubes,
+                       SdfValueTypeNames->Bool,
+                       /* custom = */ false,
+                       SdfVariabilityVarying,
+                       defaultValue,
+                       writeSparsely);
+}
+
+UsdAttribute
+CesiumTileset::GetOptimizeMeshesAttr() const
+{
+    return GetPrim().GetAttribute(CesiumTokens->cesiumOptimizeMeshes);
+}
+
+UsdAttribute
+CesiumTileset::CreateOptimizeMeshesAttr(VtValue const &defaultValue, bool writeSparsely) const
+{
+    return UsdSchemaBase::_CreateAttr(CesiumTokens->cesiumOptimizeMeshes,
+                       SdfValueTypeNames->Bool,
+                       /* custom = */ false,
+                       SdfVariabilityVarying,
+                       defaultValue,
+                       writeSparsely);
+}
+
 UsdAttribute
 CesiumTileset::GetShowCreditsOnScreenAttr() const
 {
@@ -463,6 +514,9 @@ CesiumTileset::GetSchemaAttributeNames(bool includeInherited)
         CesiumTokens->cesiumCulledScreenSpaceError,
         CesiumTokens->cesiumSuspendUpdate,
         CesiumTokens->cesiumSmoothNormals,
+        CesiumTokens->cesiumWeldNormals,
+        CesiumTokens->cesiumRenderPointsAsCubes,
+        CesiumTokens->cesiumOptimizeMeshes,
         CesiumTokens->cesiumShowCreditsOnScreen,
         CesiumTokens->cesiumMainThreadLoadingTimeLimit,
     };
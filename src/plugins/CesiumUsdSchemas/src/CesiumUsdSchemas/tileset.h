@@ -506,6 +506,72 @@ public:
     CESIUMUSDSCHEMAS_API
     UsdAttribute CreateSmoothNormalsAttr(VtValue const &defaultValue = VtValue(), bool writeSparsely=false) const;
 
+public:
+    // --------------------------------------------------------------------- //
+    // WELDNORMALS 
+    // --------------------------------------------------------------------- //
+    /// When smooth normals are generated, average them across vertices that share a position so that seams where vertices were split for texture coordinates don't shade as hard edges. Only applies when smooth normals are enabled.
+    ///
+    /// | ||
+    /// | -- | -- |
+    /// | Declaration | `bool cesium:weldNormals = 0` |
+    /// | C++ Type | bool |
+    /// | \ref Usd_Datatypes "Usd Type" | SdfValueTypeNames->Bool |
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute GetWeldNormalsAttr() const;
+
+    /// See GetWeldNormalsAttr(), and also 
+    /// \ref Usd_Create_Or_Get_Property for when to use Get vs Create.
+    /// If specified, author \p defaultValue as the attribute's default,
+    /// sparsely (when it makes sense to do so) if \p writeSparsely is \c true -
+    /// the default for \p writeSparsely is \c false.
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute CreateWeldNormalsAttr(VtValue const &defaultValue = VtValue(), bool writeSparsely=false) const;
+
+public:
+    // --------------------------------------------------------------------- //
+    // RENDERPOINTSASCUBES 
+    // --------------------------------------------------------------------- //
+    /// Render point clouds as a cube per point instead of as points. Uses much more memory and is only meant as a fallback.
+    ///
+    /// | ||
+    /// | -- | -- |
+    /// | Declaration | `bool cesium:renderPointsAsCubes = 0` |
+    /// | C++ Type | bool |
+    /// | \ref Usd_Datatypes "Usd Type" | SdfValueTypeNames->Bool |
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute GetRenderPointsAsCubesAttr() const;
+
+    /// See GetRenderPointsAsCubesAttr(), and also 
+    /// \ref Usd_Create_Or_Get_Property for when to use Get vs Create.
+    /// If specified, author \p defaultValue as the attribute's default,
+    /// sparsely (when it makes sense to do so) if \p writeSparsely is \c true -
+    /// the default for \p writeSparsely is \c false.
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute CreateRenderPointsAsCubesAttr(VtValue const &defaultValue = VtValue(), bool writeSparsely=false) const;
+
+public:
+    // --------------------------------------------------------------------- //
+    // OPTIMIZEMESHES 
+    // --------------------------------------------------------------------- //
+    /// Reorders each tile's triangles and vertices on load so that the GPU processes fewer vertices and draws fewer hidden pixels. Costs extra CPU time on worker threads when tiles load.
+    ///
+    /// | ||
+    /// | -- | -- |
+    /// | Declaration | `bool cesium:optimizeMeshes = 0` |
+    /// | C++ Type | bool |
+    /// | \ref Usd_Datatypes "Usd Type" | SdfValueTypeNames->Bool |
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute GetOptimizeMeshesAttr() const;
+
+    /// See GetOptimizeMeshesAttr(), and also 
+    /// \ref Usd_Create_Or_Get_Property for when to use Get vs Create.
+    /// If specified, author \p defaultValue as the attribute's default,
+    /// sparsely (when it makes sense to do so) if \p writeSparsely is \c true -
+    /// the default for \p writeSparsely is \c false.
+    CESIUMUSDSCHEMAS_API
+    UsdAttribute CreateOptimizeMeshesAttr(VtValue const &defaultValue = VtValue(), bool writeSparsely=false) const;
+
 public:
     // --------------------------------------------------------------------- //
     // SHOWCREDITSONSCREEN 
@@ -42,16 +42,19 @@ CesiumTokensType::CesiumTokensType() :
     cesiumMaximumCachedBytes("cesium:maximumCachedBytes", TfToken::Immortal),
     cesiumMaximumScreenSpaceError("cesium:maximumScreenSpaceError", TfToken::Immortal),
     cesiumMaximumSimultaneousTileLoads("cesium:maximumSimultaneousTileLoads", TfToken::Immortal),
+    cesiumOptimizeMeshes("cesium:optimizeMeshes", TfToken::Immortal),
     cesiumPreloadAncestors("cesium:preloadAncestors", TfToken::Immortal),
     cesiumPreloadSiblings("cesium:preloadSiblings", TfToken::Immortal),
     cesiumProjectDefaultIonAccessToken("cesium:projectDefaultIonAccessToken", TfToken::Immortal),
     cesiumProjectDefaultIonAccessTokenId("cesium:projectDefaultIonAccessTokenId", TfToken::Immortal),
+    cesiumRenderPointsAsCubes("cesium:renderPointsAsCubes", TfToken::Immortal),
     cesiumSelectedIonServer("cesium:selectedIonServer", TfToken::Immortal),
     cesiumShowCreditsOnScreen("cesium:showCreditsOnScreen", TfToken::Immortal),
     cesiumSmoothNormals("cesium:smoothNormals", TfToken::Immortal),
     cesiumSourceType("cesium:sourceType", TfToken::Immortal),
     cesiumSuspendUpdate("cesium:suspendUpdate", TfToken::Immortal),
     cesiumUrl("cesium:url", TfToken::Immortal),
+    cesiumWeldNormals("cesium:weldNormals", TfToken::Immortal),
     ion("ion", TfToken::Immortal),
     url("url", TfToken::Immortal),
     allTokens({
@@ -94,16 +97,19 @@ CesiumTokensType::CesiumTokensType() :
         cesiumMaximumCachedBytes,
         cesiumMaximumScreenSpaceError,
         cesiumMaximumSimultaneousTileLoads,
+        cesiumOptimizeMeshes,
         cesiumPreloadAncestors,
         cesiumPreloadSiblings,
         cesiumProjectDefaultIonAccessToken,
         cesiumProjectDefaultIonAccessTokenId,
+        cesiumRenderPointsAsCubes,
         cesiumSelectedIonServer,
         cesiumShowCreditsOnScreen,
         cesiumSmoothNormals,
         cesiumSourceType,
         cesiumSuspendUpdate,
         cesiumUrl,
+        cesiumWeldNormals,
         ion,
         url
     })
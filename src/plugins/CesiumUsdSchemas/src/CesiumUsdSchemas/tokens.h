@@ -195,6 +195,10 @@ struct CesiumTokensType {
     /// 
     /// CesiumTileset
     const TfToken cesiumMaximumSimultaneousTileLoads;
+    /// \brief "cesium:optimizeMeshes"
+    /// 
+    /// CesiumTileset
+    const TfToken cesiumOptimizeMeshes;
     /// \brief "cesium:preloadAncestors"
     /// 
     /// CesiumTileset
@@ -211,6 +215,10 @@ struct CesiumTokensType {
     /// 
     /// CesiumIonServer, CesiumData
     const TfToken cesiumProjectDefaultIonAccessTokenId;
+    /// \brief "cesium:renderPointsAsCubes"
+    /// 
+    /// CesiumTileset
+    const TfToken cesiumRenderPointsAsCubes;
     /// \brief "cesium:selectedIonServer"
     /// 
     /// CesiumData
@@ -235,6 +243,10 @@ struct CesiumTokensType {
     /// 
     /// CesiumTileset
     const TfToken cesiumUrl;
+    /// \brief "cesium:weldNormals"
+    /// 
+    /// CesiumTileset
+    const TfToken cesiumWeldNormals;
     /// \brief "ion"
     /// 
     /// Possible value for CesiumTileset::GetSourceTypeAttr(), Default value for CesiumTileset::GetSourceTypeAttr()
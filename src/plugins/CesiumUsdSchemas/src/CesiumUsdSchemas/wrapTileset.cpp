@@ -145,6 +145,27 @@ _CreateSmoothNormalsAttr(CesiumTileset &self,
         UsdPythonToSdfType(defaultVal, SdfValueTypeNames->Bool), writeSparsely);
 }
         
+static UsdAttribute
+_CreateWeldNormalsAttr(CesiumTileset &self,
+                                      object defaultVal, bool writeSparsely) {
+    return self.CreateWeldNormalsAttr(
+        UsdPythonToSdfType(defaultVal, SdfValueTypeNames->Bool), writeSparsely);
+}
+        
+static UsdAttribute
+_CreateRenderPointsAsCubesAttr(CesiumTileset &self,
+                                      object defaultVal, bool writeSparsely) {
+    return self.CreateRenderPointsAsCubesAttr(
+        UsdPythonToSdfType(defaultVal, SdfValueTypeNames->Bool), writeSparsely);
+}
+        
+static UsdAttribute
+_CreateOptimizeMeshesAttr(CesiumTileset &self,
+                                      object defaultVal, bool writeSparsely) {
+    return self.CreateOptimizeMeshesAttr(
+        UsdPythonToSdfType(defaultVal, SdfValueTypeNames->Bool), writeSparsely);
+}
+        
 static UsdAttribute
 _CreateShowCreditsOnScreenAttr(CesiumTileset &self,
                                       object defaultVal, bool writeSparsely) {
@@ -320,6 +341,27 @@ void wrapCesiumTileset()
              (arg("defaultValue")=object(),
               arg("writeSparsely")=false))
         
+        .def("GetWeldNormalsAttr",
+             &This::GetWeldNormalsAttr)
+        .def("CreateWeldNormalsAttr",
+             &_CreateWeldNormalsAttr,
+             (arg("defaultValue")=object(),
+              arg("writeSparsely")=false))
+        
+        .def("GetRenderPointsAsCubesAttr",
+             &This::GetRenderPointsAsCubesAttr)
+        .def("CreateRenderPointsAsCubesAttr",
+             &_CreateRenderPointsAsCubesAttr,
+             (arg("defaultValue")=object(),
+              arg("writeSparsely")=false))
+        
+        .def("GetOptimizeMeshesAttr",
+             &This::GetOptimizeMeshesAttr)
+        .def("CreateOptimizeMeshesAttr",
+             &_CreateOptimizeMeshesAttr,
+             (arg("defaultValue")=object(),
+              arg("writeSparsely")=false))
+        
         .def("GetShowCreditsOnScreenAttr",
              &This::GetShowCreditsOnScreenAttr)
         .def("CreateShowCreditsOnScreenAttr",
@@ -0,0 +1,151 @@
+#include <cesium/omniverse/ArchiveAssetAccessor.h>
+#include <cesium/omniverse/TaskProcessor.h>
+#include <doctest/doctest.h>
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/IAssetRequest.h>
+#include <CesiumAsync/IAssetResponse.h>
+#include <CesiumUtility/Uri.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace cesium::omniverse;
+
+namespace {
+
+const std::string TILESET_JSON = R"({"asset":{"version":"1.0"},"root":{"content":{"uri":"tiles/0.b3dm"}}})";
+const std::string TILE_CONTENT = "b3dm";
+
+void writeLittleEndian(std::vector<char>& buffer, uint64_t value, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        buffer.push_back(static_cast<char>(value >> (8 * i)));
+    }
+}
+
+// Builds a minimal zip archive of stored entries. CRCs are left as zero since ZipArchive doesn't verify them.
+std::vector<char> buildArchive(const std::vector<std::pair<std::string, std::string>>& entries) {
+    std::vector<char> archive;
+    std::vector<char> centralDirectory;
+
+    for (const auto& [name, data] : entries) {
+        const auto localHeaderOffset = archive.size();
+
+        writeLittleEndian(archive, 0x04034b50, 4);
+        writeLittleEndian(archive, 20, 2);
+        writeLittleEndian(archive, 0, 2);
+        writeLittleEndian(archive, 0, 2);
+        writeLittleEndian(archive, 0, 4);
+        writeLittleEndian(archive, 0, 4);
+        writeLittleEndian(archive, data.size(), 4);
+        writeLittleEndian(archive, data.size(), 4);
+        writeLittleEndian(archive, name.size(), 2);
+        writeLittleEndian(archive, 0, 2);
+        archive.insert(archive.end(), name.begin(), name.end());
+        archive.insert(archive.end(), data.begin(), data.end());
+
+        writeLittleEndian(centralDirectory, 0x02014b50, 4);
+        writeLittleEndian(centralDirectory, 20, 2);
+        writeLittleEndian(centralDirectory, 20, 2);
+        writeLittleEndian(centralDirectory, 0, 2);
+        writeLittleEndian(centralDirectory, 0, 2);
+        writeLittleEndian(centralDirectory, 0, 4);
+        writeLittleEndian(centralDirectory, 0, 4);
+        writeLittleEndian(centralDirectory, data.size(), 4);
+        writeLittleEndian(centralDirectory, data.size(), 4);
+        writeLittleEndian(centralDirectory, name.size(), 2);
+        writeLittleEndian(centralDirectory, 0, 2);
+        writeLittleEndian(centralDirectory, 0, 2);
+        writeLittleEndian(centralDirectory, 0, 2);
+        writeLittleEndian(centralDirectory, 0, 2);
+        writeLittleEndian(centralDirectory, 0, 4);
+        writeLittleEndian(centralDirectory, localHeaderOffset, 4);
+        centralDirectory.insert(centralDirectory.end(), name.begin(), name.end());
+    }
+
+    const auto centralDirectoryOffset = archive.size();
+    archive.insert(archive.end(), centralDirectory.begin(), centralDirectory.end());
+
+    writeLittleEndian(archive, 0x06054b50, 4);
+    writeLittleEndian(archive, 0, 2);
+    writeLittleEndian(archive, 0, 2);
+    writeLittleEndian(archive, entries.size(), 2);
+    writeLittleEndian(archive, entries.size(), 2);
+    writeLittleEndian(archive, centralDirectory.size(), 4);
+    writeLittleEndian(archive, centralDirectoryOffset, 4);
+    writeLittleEndian(archive, 0, 2);
+
+    return archive;
+}
+
+std::filesystem::path writeTemporaryFile(const std::string& fileName, const std::vector<char>& contents) {
+    const auto path = std::filesystem::temp_directory_path() / fileName;
+    std::ofstream stream(path, std::ios::binary);
+    stream.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    return path;
+}
+
+std::string getFileUrl(const std::filesystem::path& path) {
+    const auto genericPath = path.generic_string();
+    return genericPath.front() == '/' ? "file://" + genericPath : "file:///" + genericPath;
+}
+
+std::string getData(const CesiumAsync::IAssetRequest& request) {
+    const auto pResponse = request.response();
+
+    REQUIRE(pResponse != nullptr);
+    REQUIRE(pResponse->statusCode() == 200);
+
+    const auto data = pResponse->data();
+    return {reinterpret_cast<const char*>(data.data()), data.size()};
+}
+
+} // namespace
+
+TEST_SUITE("Archive asset accessor tests") {
+    TEST_CASE("Resolves relative tile URLs inside the archive") {
+        const auto path = writeTemporaryFile(
+            "cesium_archive_asset_accessor_test.3tz",
+            buildArchive({{"tileset.json", TILESET_JSON}, {"tiles/0.b3dm", TILE_CONTENT}}));
+
+        const auto pTaskProcessor = std::make_shared<TaskProcessor>(2);
+        const auto asyncSystem = CesiumAsync::AsyncSystem(pTaskProcessor);
+
+        // Only archive requests are made, so there's nothing to forward to
+        const auto pArchiveAssetAccessor = std::make_shared<ArchiveAssetAccessor>(nullptr);
+
+        for (const auto& rootUrl : {getFileUrl(path), getFileUrl(path) + "/tileset.json"}) {
+            const auto pRootRequest = pArchiveAssetAccessor->get(asyncSystem, rootUrl).wait();
+            CHECK(getData(*pRootRequest) == TILESET_JSON);
+
+            // Resolved the same way cesium-native resolves content URIs against the tileset's URL
+            const auto tileUrl = CesiumUtility::Uri::resolve(pRootRequest->url(), "tiles/0.b3dm");
+            CHECK(tileUrl == getFileUrl(path) + "/tiles/0.b3dm");
+
+            const auto pTileRequest = pArchiveAssetAccessor->get(asyncSystem, tileUrl).wait();
+            CHECK(getData(*pTileRequest) == TILE_CONTENT);
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Returns 404 for entries that aren't in the archive") {
+        const auto path = writeTemporaryFile(
+            "cesium_archive_asset_accessor_missing_test.3tz", buildArchive({{"tileset.json", TILESET_JSON}}));
+
+        const auto pTaskProcessor = std::make_shared<TaskProcessor>(2);
+        const auto asyncSystem = CesiumAsync::AsyncSystem(pTaskProcessor);
+        const auto pArchiveAssetAccessor = std::make_shared<ArchiveAssetAccessor>(nullptr);
+
+        const auto pRequest = pArchiveAssetAccessor->get(asyncSystem, getFileUrl(path) + "/tiles/1.b3dm").wait();
+        REQUIRE(pRequest->response() != nullptr);
+        CHECK(pRequest->response()->statusCode() == 404);
+
+        std::filesystem::remove(path);
+    }
+}
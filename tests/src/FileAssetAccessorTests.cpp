@@ -0,0 +1,88 @@
+#include <cesium/omniverse/FileAssetAccessor.h>
+#include <cesium/omniverse/TaskProcessor.h>
+#include <doctest/doctest.h>
+#include <zlib.h>
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/IAssetRequest.h>
+#include <CesiumAsync/IAssetResponse.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace cesium::omniverse;
+
+namespace {
+
+const std::string TILESET_JSON = R"({"asset":{"version":"1.0"},"geometricError":100,"root":{}})";
+
+std::vector<char> gzip(const std::string& str) {
+    z_stream stream{};
+    deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY);
+
+    std::vector<char> output(deflateBound(&stream, static_cast<uLong>(str.size())));
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(str.data()));
+    stream.avail_in = static_cast<uInt>(str.size());
+    stream.next_out = reinterpret_cast<Bytef*>(output.data());
+    stream.avail_out = static_cast<uInt>(output.size());
+
+    deflate(&stream, Z_FINISH);
+    output.resize(stream.total_out);
+    deflateEnd(&stream);
+
+    return output;
+}
+
+std::filesystem::path writeTemporaryFile(const std::string& fileName, const std::vector<char>& contents) {
+    const auto path = std::filesystem::temp_directory_path() / fileName;
+    std::ofstream stream(path, std::ios::binary);
+    stream.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    return path;
+}
+
+std::string getFileUrl(const std::filesystem::path& path) {
+    const auto genericPath = path.generic_string();
+    return genericPath.front() == '/' ? "file://" + genericPath : "file:///" + genericPath;
+}
+
+std::string loadFile(const std::filesystem::path& path) {
+    const auto pTaskProcessor = std::make_shared<TaskProcessor>(2);
+    const auto asyncSystem = CesiumAsync::AsyncSystem(pTaskProcessor);
+
+    // Only file:// requests are made, so there's nothing to forward to
+    FileAssetAccessor fileAssetAccessor(nullptr);
+
+    const auto pRequest = fileAssetAccessor.get(asyncSystem, getFileUrl(path)).wait();
+    const auto pResponse = pRequest->response();
+
+    REQUIRE(pResponse != nullptr);
+    REQUIRE(pResponse->statusCode() == 200);
+
+    const auto data = pResponse->data();
+    return {reinterpret_cast<const char*>(data.data()), data.size()};
+}
+
+} // namespace
+
+TEST_SUITE("File asset accessor tests") {
+    TEST_CASE("Serves uncompressed files as is") {
+        const auto path = writeTemporaryFile(
+            "cesium_file_asset_accessor_tileset.json", std::vector<char>(TILESET_JSON.begin(), TILESET_JSON.end()));
+
+        CHECK(loadFile(path) == TILESET_JSON);
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Inflates gzipped files") {
+        const auto path = writeTemporaryFile("cesium_file_asset_accessor_tileset_gzip.json", gzip(TILESET_JSON));
+
+        CHECK(loadFile(path) == TILESET_JSON);
+
+        std::filesystem::remove(path);
+    }
+}
@@ -0,0 +1,83 @@
+#include "cesium/omniverse/GltfAccessors.h"
+
+#include <doctest/doctest.h>
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace cesium::omniverse;
+
+namespace {
+
+// Two triangles that meet at a right angle along the edge from (0, 0, 0) to (1, 0, 0). Each triangle has its own
+// copy of the edge's vertices, like vertices that were split to give them different texture coordinates.
+const std::vector<glm::fvec3> POSITIONS{
+    {0.0f, 0.0f, 0.0f},
+    {1.0f, 0.0f, 0.0f},
+    {0.5f, 1.0f, 0.0f},
+    {1.0f, 0.0f, 0.0f},
+    {0.0f, 0.0f, 0.0f},
+    {0.5f, 0.0f, 1.0f},
+};
+
+const std::vector<uint32_t> INDICES{0, 1, 2, 3, 4, 5};
+
+const glm::fvec3 FIRST_FACE_NORMAL{0.0f, 0.0f, 1.0f};
+const glm::fvec3 SECOND_FACE_NORMAL{0.0f, 1.0f, 0.0f};
+
+std::vector<glm::fvec3> generateSmoothNormals(bool weldPositions) {
+    const auto positions = PositionsAccessor(CesiumGltf::AccessorView<glm::fvec3>(
+        reinterpret_cast<const uint8_t*>(POSITIONS.data()),
+        static_cast<int64_t>(sizeof(glm::fvec3)),
+        0,
+        static_cast<int64_t>(POSITIONS.size())));
+
+    const auto indices = IndicesAccessor(CesiumGltf::AccessorView<uint32_t>(
+        reinterpret_cast<const uint8_t*>(INDICES.data()),
+        static_cast<int64_t>(sizeof(uint32_t)),
+        0,
+        static_cast<int64_t>(INDICES.size())));
+
+    const auto normalsAccessor = NormalsAccessor::GenerateSmooth(positions, indices, weldPositions);
+
+    std::vector<glm::fvec3> normals(normalsAccessor.size());
+    normalsAccessor.fill(normals);
+
+    return normals;
+}
+
+bool isClose(const glm::fvec3& a, const glm::fvec3& b) {
+    return glm::length(a - b) < 1e-5f;
+}
+
+} // namespace
+
+TEST_SUITE("Gltf accessors tests") {
+    TEST_CASE("Generates a normal per split vertex without welding") {
+        const auto normals = generateSmoothNormals(false);
+        REQUIRE(normals.size() == POSITIONS.size());
+
+        for (uint64_t i = 0; i < 3; i++) {
+            CHECK(isClose(normals[i], FIRST_FACE_NORMAL));
+            CHECK(isClose(normals[i + 3], SECOND_FACE_NORMAL));
+        }
+    }
+
+    TEST_CASE("Averages normals across split vertices when welding") {
+        const auto normals = generateSmoothNormals(true);
+        REQUIRE(normals.size() == POSITIONS.size());
+
+        const auto edgeNormal = glm::normalize(FIRST_FACE_NORMAL + SECOND_FACE_NORMAL);
+
+        // Both copies of the shared edge get the same normal
+        CHECK(isClose(normals[0], edgeNormal));
+        CHECK(isClose(normals[1], edgeNormal));
+        CHECK(isClose(normals[3], edgeNormal));
+        CHECK(isClose(normals[4], edgeNormal));
+
+        // Vertices that aren't shared keep their face's normal
+        CHECK(isClose(normals[2], FIRST_FACE_NORMAL));
+        CHECK(isClose(normals[5], SECOND_FACE_NORMAL));
+    }
+}
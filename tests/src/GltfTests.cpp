@@ -91,7 +91,7 @@ TEST_SUITE("Test GltfUtil") {
         indices = GltfUtil::getIndices(model, prim, positions);
         CHECK(indices.size() > 0);
         if (GltfUtil::hasNormals(model, prim, false)) {
-            CHECK(GltfUtil::getNormals(model, prim, positions, indices, false).size() > 0);
+            CHECK(GltfUtil::getNormals(model, prim, positions, indices, false, false).size() > 0);
         }
         if (GltfUtil::hasVertexColors(model, prim, 0)) {
             CHECK(GltfUtil::getVertexColors(model, prim, 0).size() > 0);
@@ -0,0 +1,101 @@
+#include <cesium/omniverse/GzipUtil.h>
+#include <doctest/doctest.h>
+#include <zlib.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace cesium::omniverse;
+
+namespace {
+
+std::vector<std::byte> toBytes(const std::string& str) {
+    const auto pBytes = reinterpret_cast<const std::byte*>(str.data());
+    return {pBytes, pBytes + str.size()};
+}
+
+std::vector<std::byte> gzip(const std::string& str) {
+    z_stream stream{};
+    deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY);
+
+    std::vector<std::byte> output(deflateBound(&stream, static_cast<uLong>(str.size())));
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(str.data()));
+    stream.avail_in = static_cast<uInt>(str.size());
+    stream.next_out = reinterpret_cast<Bytef*>(output.data());
+    stream.avail_out = static_cast<uInt>(output.size());
+
+    deflate(&stream, Z_FINISH);
+    output.resize(stream.total_out);
+    deflateEnd(&stream);
+
+    return output;
+}
+
+void setTrailerSize(std::vector<std::byte>& data, uint32_t size) {
+    for (size_t i = 0; i < 4; ++i) {
+        data[data.size() - 4 + i] = static_cast<std::byte>(size >> (8 * i));
+    }
+}
+
+std::string createContent() {
+    std::string content;
+    for (uint64_t i = 0; i < 10000; ++i) {
+        content += R"({"asset":{"version":"1.0"},"geometricError":)" + std::to_string(i) + "}";
+    }
+    return content;
+}
+
+} // namespace
+
+TEST_SUITE("Gzip util tests") {
+    TEST_CASE("Inflates a gzip stream") {
+        const auto content = createContent();
+        const auto decoded = GzipUtil::gunzip(gzip(content));
+
+        REQUIRE(decoded.has_value());
+        CHECK(decoded.value() == toBytes(content));
+    }
+
+    TEST_CASE("Inflates concatenated members") {
+        auto compressed = gzip("first ");
+        const auto second = gzip("second");
+        compressed.insert(compressed.end(), second.begin(), second.end());
+
+        const auto decoded = GzipUtil::gunzip(compressed);
+
+        REQUIRE(decoded.has_value());
+        CHECK(decoded.value() == toBytes("first second"));
+    }
+
+    TEST_CASE("Grows the output past the initial size limit") {
+        // Zeros compress far better than the ratio the initial allocation is limited to
+        const auto content = std::string(4 * 1024 * 1024, '\0');
+        const auto decoded = GzipUtil::gunzip(gzip(content));
+
+        REQUIRE(decoded.has_value());
+        CHECK(decoded.value() == toBytes(content));
+    }
+
+    TEST_CASE("Doesn't trust the size in the trailer") {
+        const auto content = createContent();
+
+        for (const auto trailerSize : {uint32_t(0), uint32_t(1), uint32_t(0xffffffff)}) {
+            // zlib checks the trailer once the stream is inflated so a wrong size fails the stream
+            auto compressed = gzip(content);
+            setTrailerSize(compressed, trailerSize);
+            CHECK_FALSE(GzipUtil::gunzip(compressed).has_value());
+        }
+    }
+
+    TEST_CASE("Rejects truncated and non-gzip data") {
+        const auto content = createContent();
+        auto compressed = gzip(content);
+        compressed.resize(compressed.size() / 2);
+
+        CHECK_FALSE(GzipUtil::gunzip(compressed).has_value());
+        CHECK_FALSE(GzipUtil::gunzip(toBytes(content)).has_value());
+        CHECK_FALSE(GzipUtil::isGzip(toBytes(content)));
+    }
+}
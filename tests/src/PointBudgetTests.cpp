@@ -0,0 +1,77 @@
+#include <cesium/omniverse/PointBudget.h>
+#include <doctest/doctest.h>
+
+#include <cstdint>
+
+using namespace cesium::omniverse;
+
+TEST_SUITE("Point budget tests") {
+    TEST_CASE("Keeps every point when under budget") {
+        PointBudget pointBudget;
+        pointBudget.setBudget(1000);
+        pointBudget.add(1, 400, 1.0);
+        pointBudget.add(2, 500, 2.0);
+
+        const auto changes = pointBudget.update();
+        CHECK(changes.size() == 2);
+        CHECK(pointBudget.getStride(1) == 1);
+        CHECK(pointBudget.getStride(2) == 1);
+        CHECK(pointBudget.getPointsKept() == 900);
+
+        // Nothing changed so nothing is reported
+        CHECK(pointBudget.update().empty());
+    }
+
+    TEST_CASE("Keeps every point when the budget is zero") {
+        PointBudget pointBudget;
+        pointBudget.add(1, 1000000, 1.0);
+
+        static_cast<void>(pointBudget.update());
+        CHECK(pointBudget.getStride(1) == 1);
+    }
+
+    TEST_CASE("Decimates point clouds with smaller weights more") {
+        PointBudget pointBudget;
+        pointBudget.setBudget(1000);
+        pointBudget.add(1, 1000, 1.0);
+        pointBudget.add(2, 1000, 8.0);
+
+        static_cast<void>(pointBudget.update());
+        CHECK(pointBudget.getPointsKept() <= 1000);
+        CHECK(pointBudget.getStride(1) > pointBudget.getStride(2));
+    }
+
+    TEST_CASE("Restores points when the budget frees up") {
+        PointBudget pointBudget;
+        pointBudget.setBudget(1000);
+        pointBudget.add(1, 1000, 1.0);
+        pointBudget.add(2, 1000, 1.0);
+
+        static_cast<void>(pointBudget.update());
+        CHECK(pointBudget.getStride(1) == 2);
+        CHECK(pointBudget.getStride(2) == 2);
+
+        pointBudget.remove(2);
+
+        const auto changes = pointBudget.update();
+        CHECK(changes.size() == 1);
+        CHECK(changes[0].first == 1);
+        CHECK(changes[0].second == 1);
+        CHECK(pointBudget.getPointsKept() == 1000);
+    }
+
+    TEST_CASE("Ignores small weight changes") {
+        PointBudget pointBudget;
+        pointBudget.setBudget(1000);
+        pointBudget.add(1, 1000, 1.0);
+        pointBudget.add(2, 1000, 1.0);
+        static_cast<void>(pointBudget.update());
+
+        pointBudget.setWeight(1, 1.05);
+        CHECK(pointBudget.update().empty());
+
+        pointBudget.setWeight(1, 4.0);
+        CHECK(!pointBudget.update().empty());
+        CHECK(pointBudget.getStride(1) < pointBudget.getStride(2));
+    }
+}
@@ -0,0 +1,117 @@
+#include <cesium/omniverse/HttpAssetAccessor.h>
+#include <cesium/omniverse/RequestArchive.h>
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace cesium::omniverse;
+
+namespace {
+
+std::vector<std::byte> toBytes(const std::string& str) {
+    const auto pBytes = reinterpret_cast<const std::byte*>(str.data());
+    return {pBytes, pBytes + str.size()};
+}
+
+std::filesystem::path writeArchive(const std::string& fileName) {
+    const auto path = std::filesystem::temp_directory_path() / fileName;
+    RequestArchiveWriter writer(path);
+
+    writer.write(HttpAssetRequest(
+        "GET",
+        "https://example.com/tileset.json",
+        {{"Accept", "application/json"}},
+        HttpAssetResponse(
+            200, CesiumAsync::HttpHeaders{{"Content-Type", "application/json"}}, toBytes(R"({"asset":{}})"))));
+
+    writer.write(HttpAssetRequest(
+        "GET", "https://example.com/missing.b3dm", {}, HttpAssetResponse(404, CesiumAsync::HttpHeaders(), {})));
+
+    return path;
+}
+
+void overwriteInteger(const std::filesystem::path& path, uint64_t offset, uint64_t value) {
+    std::fstream stream(path, std::ios::binary | std::ios::in | std::ios::out);
+    stream.seekp(static_cast<std::streamoff>(offset));
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+} // namespace
+
+TEST_SUITE("Request archive tests") {
+    TEST_CASE("Round trips requests") {
+        const auto path = writeArchive("cesium_request_archive_round_trip.bin");
+
+        RequestArchiveReader reader(path);
+        const auto& entries = reader.getEntries();
+        REQUIRE(entries.size() == 2);
+
+        CHECK(entries[0].method == "GET");
+        CHECK(entries[0].url == "https://example.com/tileset.json");
+        CHECK(entries[0].requestHeaders.at("Accept") == "application/json");
+        CHECK(entries[0].statusCode == 200);
+        CHECK(entries[0].responseHeaders.at("Content-Type") == "application/json");
+        CHECK(reader.readData(entries[0]) == toBytes(R"({"asset":{}})"));
+
+        CHECK(entries[1].url == "https://example.com/missing.b3dm");
+        CHECK(entries[1].requestHeaders.empty());
+        CHECK(entries[1].statusCode == 404);
+        CHECK(entries[1].dataSize == 0);
+        CHECK(reader.readData(entries[1]) == std::vector<std::byte>());
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Rejects truncated archives") {
+        const auto path = writeArchive("cesium_request_archive_truncated.bin");
+        const auto fileSize = std::filesystem::file_size(path);
+
+        uint64_t firstRecordEnd = 0;
+        {
+            RequestArchiveReader reader(path);
+            REQUIRE(reader.getEntries().size() == 2);
+            firstRecordEnd = reader.getEntries()[0].dataOffset + reader.getEntries()[0].dataSize;
+        }
+
+        // Every truncation point after the magic number cuts a record short, except the end of the first record
+        // which leaves a valid archive with one record
+        for (auto size = fileSize - 1; size > 8; --size) {
+            std::filesystem::resize_file(path, size);
+            RequestArchiveReader reader(path);
+            CHECK(reader.getEntries().size() == (size == firstRecordEnd ? 1 : 0));
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Rejects lengths that run past the end of the archive") {
+        const auto path = writeArchive("cesium_request_archive_corrupt.bin");
+
+        // The method length of the first record follows the magic number
+        overwriteInteger(path, 8, 0xffffffffffffffff);
+
+        RequestArchiveReader reader(path);
+        CHECK(reader.getEntries().empty());
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Detects short reads of response bodies") {
+        const auto path = writeArchive("cesium_request_archive_short_read.bin");
+
+        RequestArchiveReader reader(path);
+        REQUIRE(reader.getEntries().size() == 2);
+
+        const auto& entry = reader.getEntries()[0];
+        std::filesystem::resize_file(path, entry.dataOffset + entry.dataSize - 1);
+
+        CHECK_FALSE(reader.readData(entry).has_value());
+
+        std::filesystem::remove(path);
+    }
+}
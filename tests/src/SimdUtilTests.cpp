@@ -0,0 +1,88 @@
+#include <cesium/omniverse/SimdUtil.h>
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace cesium::omniverse;
+
+namespace {
+
+// Covers empty input, inputs shorter than a vector and every remainder the vector loops leave to the scalar loop
+const uint64_t MAX_TESTED_COUNT = 19;
+
+template <typename T> std::vector<T> createSource(uint64_t count) {
+    std::vector<T> source(count);
+
+    for (uint64_t i = 0; i < count; ++i) {
+        source[i] = static_cast<T>(std::numeric_limits<T>::max() - i * 7);
+    }
+
+    return source;
+}
+
+template <typename T> std::vector<float> normalizeColors(const std::vector<T>& source) {
+    const auto maxValue = static_cast<float>(std::numeric_limits<T>::max());
+    std::vector<float> expected(source.size());
+
+    for (uint64_t i = 0; i < source.size(); ++i) {
+        expected[i] = static_cast<float>(source[i]) / maxValue;
+    }
+
+    return expected;
+}
+
+} // namespace
+
+TEST_SUITE("SIMD util tests") {
+    TEST_CASE("Widens unsigned integers to signed integers") {
+        for (uint64_t count = 0; count <= MAX_TESTED_COUNT; ++count) {
+            const auto uint8Source = createSource<uint8_t>(count);
+            const auto uint16Source = createSource<uint16_t>(count);
+            std::vector<int32_t> uint8Target(count);
+            std::vector<int32_t> uint16Target(count);
+
+            SimdUtil::convertUint8ToInt32(uint8Source.data(), uint8Target.data(), count);
+            SimdUtil::convertUint16ToInt32(uint16Source.data(), uint16Target.data(), count);
+
+            for (uint64_t i = 0; i < count; ++i) {
+                CHECK(uint8Target[i] == static_cast<int32_t>(uint8Source[i]));
+                CHECK(uint16Target[i] == static_cast<int32_t>(uint16Source[i]));
+            }
+        }
+    }
+
+    TEST_CASE("Flips texture coordinates vertically") {
+        for (uint64_t count = 0; count <= MAX_TESTED_COUNT; ++count) {
+            std::vector<float> source(count * 2);
+            for (uint64_t i = 0; i < source.size(); ++i) {
+                source[i] = static_cast<float>(i) * 0.125f;
+            }
+
+            std::vector<float> target(count * 2);
+            SimdUtil::copyFlipVertical(source.data(), target.data(), count);
+
+            for (uint64_t i = 0; i < count; ++i) {
+                CHECK(target[i * 2] == source[i * 2]);
+                CHECK(target[i * 2 + 1] == 1.0f - source[i * 2 + 1]);
+            }
+        }
+    }
+
+    TEST_CASE("Normalizes RGBA colors") {
+        for (uint64_t count = 0; count <= MAX_TESTED_COUNT; ++count) {
+            // Sized exactly so that reading past the last color would be caught by sanitizers
+            const auto uint8Source = createSource<uint8_t>(count * 4);
+            const auto uint16Source = createSource<uint16_t>(count * 4);
+            std::vector<float> uint8Target(count * 4);
+            std::vector<float> uint16Target(count * 4);
+
+            SimdUtil::normalizeUint8Colors(uint8Source.data(), uint8Target.data(), count);
+            SimdUtil::normalizeUint16Colors(uint16Source.data(), uint16Target.data(), count);
+
+            CHECK(uint8Target == normalizeColors(uint8Source));
+            CHECK(uint16Target == normalizeColors(uint16Source));
+        }
+    }
+}
@@ -0,0 +1,70 @@
+#include <cesium/omniverse/SlabAllocator.h>
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace cesium::omniverse;
+
+namespace {
+
+struct MockResult {
+    std::vector<uint64_t> values;
+    std::shared_ptr<int> resource;
+};
+
+} // namespace
+
+TEST_SUITE("Slab allocator tests") {
+    TEST_CASE("Reuses the memory of destroyed objects") {
+        SlabAllocator<MockResult, 4> allocator;
+
+        const auto pFirst = allocator.create(std::vector<uint64_t>{1, 2, 3}, nullptr);
+        CHECK(pFirst->values.size() == 3);
+        CHECK(allocator.getCapacity() == 4);
+        CHECK(allocator.getNumberActive() == 1);
+
+        allocator.destroy(pFirst);
+        CHECK(allocator.getNumberActive() == 0);
+
+        const auto pSecond = allocator.create();
+        CHECK(pSecond == pFirst);
+        CHECK(pSecond->values.empty());
+
+        allocator.destroy(pSecond);
+    }
+
+    TEST_CASE("Adds a slab when every slot is in use") {
+        SlabAllocator<MockResult, 2> allocator;
+
+        std::vector<MockResult*> objects;
+        for (uint64_t i = 0; i < 5; ++i) {
+            objects.push_back(allocator.create(std::vector<uint64_t>{i}, nullptr));
+        }
+
+        CHECK(allocator.getCapacity() == 6);
+        CHECK(allocator.getNumberActive() == 5);
+
+        for (uint64_t i = 0; i < 5; ++i) {
+            CHECK(objects[i]->values[0] == i);
+            allocator.destroy(objects[i]);
+        }
+
+        CHECK(allocator.getCapacity() == 6);
+        CHECK(allocator.getNumberActive() == 0);
+    }
+
+    TEST_CASE("Destroys objects owned by a unique pointer") {
+        SlabAllocator<MockResult, 2> allocator;
+        const auto resource = std::make_shared<int>(0);
+
+        {
+            const auto pResult = allocator.adopt(allocator.create(std::vector<uint64_t>{}, resource));
+            CHECK(resource.use_count() == 2);
+        }
+
+        CHECK(resource.use_count() == 1);
+        CHECK(allocator.getNumberActive() == 0);
+    }
+}
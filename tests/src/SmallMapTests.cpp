@@ -0,0 +1,63 @@
+#include <cesium/omniverse/SmallMap.h>
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+using namespace cesium::omniverse;
+
+TEST_SUITE("Small map tests") {
+    TEST_CASE("Inserts and finds entries while inline") {
+        SmallMap<uint64_t, uint64_t, 4> map;
+        CHECK(map.empty());
+
+        map[3] = 30;
+        map[1] = 10;
+        map[3] = 31;
+
+        CHECK(map.size() == 2);
+        CHECK(map.at(3) == 31);
+        CHECK(map.at(1) == 10);
+        CHECK(map.find(2) == map.end());
+        CHECK_THROWS_AS(static_cast<void>(map.at(2)), std::out_of_range);
+    }
+
+    TEST_CASE("Keeps entries in insertion order after moving to the heap") {
+        SmallMap<uint64_t, uint64_t, 2> map;
+
+        for (uint64_t i = 0; i < 5; ++i) {
+            map[10 - i] = i;
+        }
+
+        CHECK(map.size() == 5);
+
+        std::vector<uint64_t> keys;
+        for (const auto& [key, value] : map) {
+            CHECK(map.at(key) == value);
+            keys.push_back(key);
+        }
+
+        const std::vector<uint64_t> expectedKeys{10, 9, 8, 7, 6};
+        CHECK(keys == expectedKeys);
+    }
+
+    TEST_CASE("Copies and clears") {
+        SmallMap<uint64_t, uint64_t, 2> map;
+        map[1] = 1;
+        map[2] = 2;
+        map[3] = 3;
+
+        const auto copy = map;
+        map.clear();
+
+        CHECK(map.empty());
+        CHECK(map.find(1) == map.end());
+        CHECK(copy.size() == 3);
+        CHECK(copy.at(3) == 3);
+
+        map[4] = 4;
+        CHECK(map.size() == 1);
+        CHECK(map.at(4) == 4);
+    }
+}
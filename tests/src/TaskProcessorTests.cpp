@@ -0,0 +1,136 @@
+#include <cesium/omniverse/TaskProcessor.h>
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace cesium::omniverse;
+
+namespace {
+
+// Long enough to never be hit unless the task processor is broken, so that a regression fails instead of hanging
+const auto TIMEOUT = std::chrono::seconds(10);
+
+} // namespace
+
+TEST_SUITE("Task processor tests") {
+    TEST_CASE("Runs every lane on the calling thread outside the pool") {
+        std::vector<uint64_t> lanes;
+
+        CHECK(getParallelLaneCount() == 1);
+        runParallel(3, [&lanes](uint64_t laneIndex) { lanes.push_back(laneIndex); });
+
+        const auto expectedLanes = std::vector<uint64_t>{0, 1, 2};
+        CHECK(lanes == expectedLanes);
+    }
+
+    TEST_CASE("Runs every lane exactly once from a worker thread") {
+        TaskProcessor taskProcessor(2);
+        std::promise<uint64_t> laneCountPromise;
+        std::vector<std::atomic<uint64_t>> laneRunCounts(8);
+
+        // Lanes are started from inside a task that occupies one of the two workers
+        taskProcessor.startTask([&laneCountPromise, &laneRunCounts]() {
+            const auto laneCount = getParallelLaneCount();
+            runParallel(laneRunCounts.size(), [&laneRunCounts](uint64_t laneIndex) { laneRunCounts[laneIndex]++; });
+            laneCountPromise.set_value(laneCount);
+        });
+
+        CHECK(laneCountPromise.get_future().get() == 2);
+
+        for (const auto& runCount : laneRunCounts) {
+            CHECK(runCount == 1);
+        }
+    }
+
+    TEST_CASE("Runs higher priority tasks first") {
+        std::promise<void> gateStarted;
+        std::promise<void> gate;
+        std::promise<void> allDone;
+        std::mutex orderMutex;
+        std::vector<TaskPriority> order;
+
+        TaskProcessor taskProcessor(1);
+
+        // The only worker is held up so that every task below is queued before any of them can run
+        taskProcessor.startTask([&gateStarted, gateFuture = gate.get_future().share()]() {
+            gateStarted.set_value();
+            gateFuture.wait();
+        });
+        gateStarted.get_future().wait();
+
+        const auto startTask = [&](TaskPriority priority, bool last) {
+            ScopedTaskPriority scopedPriority(priority);
+            taskProcessor.startTask([&orderMutex, &order, &allDone, priority, last]() {
+                std::scoped_lock<std::mutex> lock(orderMutex);
+                order.push_back(priority);
+                if (last) {
+                    allDone.set_value();
+                }
+            });
+        };
+
+        startTask(TaskPriority::LOW, true);
+        startTask(TaskPriority::NORMAL, false);
+        startTask(TaskPriority::HIGH, false);
+        startTask(TaskPriority::NORMAL, false);
+
+        gate.set_value();
+        REQUIRE(allDone.get_future().wait_for(TIMEOUT) == std::future_status::ready);
+
+        const auto expectedOrder = std::vector<TaskPriority>{
+            TaskPriority::HIGH,
+            TaskPriority::NORMAL,
+            TaskPriority::NORMAL,
+            TaskPriority::LOW,
+        };
+        CHECK(order == expectedOrder);
+    }
+
+    TEST_CASE("Idle workers steal tasks from busy workers") {
+        std::promise<std::thread::id> childThreadId;
+        std::promise<bool> childRan;
+
+        TaskProcessor taskProcessor(2);
+
+        // The child is queued on the parent's own worker, which then waits for it. Only the other worker can run it.
+        taskProcessor.startTask([&taskProcessor, &childThreadId, &childRan]() {
+            auto childThreadIdFuture = childThreadId.get_future();
+            taskProcessor.startTask([&childThreadId]() { childThreadId.set_value(std::this_thread::get_id()); });
+
+            const auto ready = childThreadIdFuture.wait_for(TIMEOUT) == std::future_status::ready;
+            childRan.set_value(ready && childThreadIdFuture.get() != std::this_thread::get_id());
+        });
+
+        CHECK(childRan.get_future().get());
+    }
+
+    TEST_CASE("Runs blocking tasks while every worker is busy") {
+        std::promise<std::thread::id> blockingThreadId;
+        std::promise<bool> blockingTaskRan;
+
+        TaskProcessor taskProcessor(1);
+
+        // The only worker waits for the blocking task, so the blocking task must run on a thread of its own
+        taskProcessor.startTask([&taskProcessor, &blockingThreadId, &blockingTaskRan]() {
+            const auto workerThreadId = std::this_thread::get_id();
+            auto blockingThreadIdFuture = blockingThreadId.get_future();
+
+            {
+                ScopedTaskPriority scopedPriority(TaskPriority::BLOCKING);
+                taskProcessor.startTask(
+                    [&blockingThreadId]() { blockingThreadId.set_value(std::this_thread::get_id()); });
+            }
+
+            const auto ready = blockingThreadIdFuture.wait_for(TIMEOUT) == std::future_status::ready;
+            blockingTaskRan.set_value(ready && blockingThreadIdFuture.get() != workerThreadId);
+        });
+
+        CHECK(blockingTaskRan.get_future().get());
+    }
+}
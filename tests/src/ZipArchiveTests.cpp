@@ -0,0 +1,212 @@
+#include <cesium/omniverse/ZipArchive.h>
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace cesium::omniverse;
+
+namespace {
+
+const std::string TILESET_JSON = R"({"asset":{"version":"1.0"},"root":{}})";
+
+// Raw deflate stream of TILESET_JSON repeated four times
+const std::vector<uint8_t> DEFLATED_TILESET_JSON{
+    0xab, 0x56, 0x4a, 0x2c, 0x2e, 0x4e, 0x2d, 0x51, 0xb2, 0xaa, 0x56, 0x2a, 0x4b, 0x2d, 0x2a, 0xce,
+    0xcc, 0xcf, 0x53, 0xb2, 0x52, 0x32, 0xd4, 0x33, 0x50, 0xaa, 0xd5, 0x51, 0x2a, 0xca, 0xcf, 0x07,
+    0x49, 0xd4, 0xd6, 0x56, 0xd3, 0x57, 0x11, 0x00,
+};
+
+struct TestEntry {
+    std::string name;
+    uint16_t compressionMethod;
+    std::vector<uint8_t> data;
+    uint32_t uncompressedSize;
+};
+
+void writeLittleEndian(std::vector<uint8_t>& buffer, uint64_t value, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        buffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+// Builds a minimal zip archive. CRCs are left as zero since ZipArchive doesn't verify them.
+std::vector<uint8_t> buildArchive(const std::vector<TestEntry>& entries) {
+    std::vector<uint8_t> archive;
+    std::vector<uint8_t> centralDirectory;
+
+    for (const auto& entry : entries) {
+        const auto localHeaderOffset = archive.size();
+
+        writeLittleEndian(archive, 0x04034b50, 4);
+        writeLittleEndian(archive, 20, 2);
+        writeLittleEndian(archive, 0, 2);
+        writeLittleEndian(archive, entry.compressionMethod, 2);
+        writeLittleEndian(archive, 0, 4);
+        writeLittleEndian(archive, 0, 4);
+        writeLittleEndian(archive, entry.data.size(), 4);
+        writeLittleEndian(archive, entry.uncompressedSize, 4);
+        writeLittleEndian(archive, entry.name.size(), 2);
+        writeLittleEndian(archive, 0, 2);
+        archive.insert(archive.end(), entry.name.begin(), entry.name.end());
+        archive.insert(archive.end(), entry.data.begin(), entry.data.end());
+
+        writeLittleEndian(centralDirectory, 0x02014b50, 4);
+        writeLittleEndian(centralDirectory, 20, 2);
+        writeLittleEndian(centralDirectory, 20, 2);
+        writeLittleEndian(centralDirectory, 0, 2);
+        writeLittleEndian(centralDirectory, entry.compressionMethod, 2);
+        writeLittleEndian(centralDirectory, 0, 4);
+        writeLittleEndian(centralDirectory, 0, 4);
+        writeLittleEndian(centralDirectory, entry.data.size(), 4);
+        writeLittleEndian(centralDirectory, entry.uncompressedSize, 4);
+        writeLittleEndian(centralDirectory, entry.name.size(), 2);
+        writeLittleEndian(centralDirectory, 0, 2);
+        writeLittleEndian(centralDirectory, 0, 2);
+        writeLittleEndian(centralDirectory, 0, 2);
+        writeLittleEndian(centralDirectory, 0, 2);
+        writeLittleEndian(centralDirectory, 0, 4);
+        writeLittleEndian(centralDirectory, localHeaderOffset, 4);
+        centralDirectory.insert(centralDirectory.end(), entry.name.begin(), entry.name.end());
+    }
+
+    const auto centralDirectoryOffset = archive.size();
+    archive.insert(archive.end(), centralDirectory.begin(), centralDirectory.end());
+
+    writeLittleEndian(archive, 0x06054b50, 4);
+    writeLittleEndian(archive, 0, 2);
+    writeLittleEndian(archive, 0, 2);
+    writeLittleEndian(archive, entries.size(), 2);
+    writeLittleEndian(archive, entries.size(), 2);
+    writeLittleEndian(archive, centralDirectory.size(), 4);
+    writeLittleEndian(archive, centralDirectoryOffset, 4);
+    writeLittleEndian(archive, 0, 2);
+
+    return archive;
+}
+
+std::filesystem::path writeTemporaryFile(const std::string& fileName, const std::vector<uint8_t>& contents) {
+    const auto path = std::filesystem::temp_directory_path() / fileName;
+    std::ofstream stream(path, std::ios::binary);
+    stream.write(reinterpret_cast<const char*>(contents.data()), static_cast<std::streamsize>(contents.size()));
+    return path;
+}
+
+std::string toString(gsl::span<const std::byte> data) {
+    return {reinterpret_cast<const char*>(data.data()), data.size()};
+}
+
+} // namespace
+
+TEST_SUITE("Zip archive tests") {
+    TEST_CASE("Reads stored and deflated entries") {
+        std::string repeatedTilesetJson;
+        for (auto i = 0; i < 4; ++i) {
+            repeatedTilesetJson += TILESET_JSON;
+        }
+
+        const auto path = writeTemporaryFile(
+            "cesium-omniverse-zip-archive-test.3tz",
+            buildArchive({
+                {"tileset.json",
+                 0,
+                 std::vector<uint8_t>(TILESET_JSON.begin(), TILESET_JSON.end()),
+                 static_cast<uint32_t>(TILESET_JSON.size())},
+                {"tiles/", 0, {}, 0},
+                {"tiles/deflated.json",
+                 8,
+                 DEFLATED_TILESET_JSON,
+                 static_cast<uint32_t>(repeatedTilesetJson.size())},
+            }));
+
+        {
+            const auto pArchive = ZipArchive::open(path);
+            REQUIRE(pArchive);
+
+            // Directories aren't indexed
+            CHECK(pArchive->getEntryCount() == 2);
+            CHECK(pArchive->contains("tileset.json"));
+            CHECK(pArchive->contains("tiles/deflated.json"));
+            CHECK_FALSE(pArchive->contains("tiles/"));
+            CHECK_FALSE(pArchive->contains("missing.json"));
+
+            const auto storedEntry = pArchive->getStoredEntry("tileset.json");
+            REQUIRE(storedEntry.has_value());
+            CHECK(toString(storedEntry.value()) == TILESET_JSON);
+
+            CHECK_FALSE(pArchive->getStoredEntry("tiles/deflated.json").has_value());
+
+            const auto deflatedEntry = pArchive->readEntry("tiles/deflated.json");
+            REQUIRE(deflatedEntry.has_value());
+            CHECK(toString(deflatedEntry.value()) == repeatedTilesetJson);
+
+            CHECK_FALSE(pArchive->readEntry("missing.json").has_value());
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Rejects entries whose sizes don't match their data") {
+        std::string repeatedTilesetJson;
+        for (auto i = 0; i < 4; ++i) {
+            repeatedTilesetJson += TILESET_JSON;
+        }
+
+        const auto repeatedSize = static_cast<uint32_t>(repeatedTilesetJson.size());
+
+        const auto path = writeTemporaryFile(
+            "cesium-omniverse-zip-archive-sizes-test.3tz",
+            buildArchive({
+                {"stored.json",
+                 0,
+                 std::vector<uint8_t>(TILESET_JSON.begin(), TILESET_JSON.end()),
+                 static_cast<uint32_t>(TILESET_JSON.size() + 1)},
+                {"short.json", 8, DEFLATED_TILESET_JSON, repeatedSize - 1},
+                {"long.json", 8, DEFLATED_TILESET_JSON, repeatedSize + 1},
+                {"huge.json", 8, DEFLATED_TILESET_JSON, 0xfffffffe},
+            }));
+
+        {
+            const auto pArchive = ZipArchive::open(path);
+            REQUIRE(pArchive);
+
+            CHECK_FALSE(pArchive->getStoredEntry("stored.json").has_value());
+            CHECK_FALSE(pArchive->readEntry("stored.json").has_value());
+            CHECK_FALSE(pArchive->readEntry("short.json").has_value());
+            CHECK_FALSE(pArchive->readEntry("long.json").has_value());
+
+            // Larger than deflate could possibly expand the data to, so it's rejected without being allocated
+            CHECK_FALSE(pArchive->readEntry("huge.json").has_value());
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Rejects entry counts that don't fit in the central directory") {
+        auto archive = buildArchive({{"tileset.json", 0, {}, 0}});
+
+        // Entry counts in the end of central directory record
+        const auto eocdOffset = archive.size() - 22;
+        archive[eocdOffset + 8] = 0xff;
+        archive[eocdOffset + 10] = 0xff;
+
+        const auto path = writeTemporaryFile("cesium-omniverse-zip-archive-count-test.3tz", archive);
+
+        CHECK_FALSE(ZipArchive::open(path));
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Rejects files that aren't zip archives") {
+        const auto path =
+            writeTemporaryFile("cesium-omniverse-zip-archive-test.txt", {'n', 'o', 't', ' ', 'z', 'i', 'p'});
+
+        CHECK_FALSE(ZipArchive::open(path));
+        CHECK_FALSE(ZipArchive::open(std::filesystem::temp_directory_path() / "cesium-omniverse-missing.3tz"));
+
+        std::filesystem::remove(path);
+    }
+}